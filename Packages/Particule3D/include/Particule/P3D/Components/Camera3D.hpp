@@ -0,0 +1,54 @@
+#ifndef P3D_COMPO_CAMERA3D_HPP
+#define P3D_COMPO_CAMERA3D_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+#include <Particule/P3D/Raster/Framebuffer.hpp>
+#include <Particule/P3D/Raster/Rasterizer.hpp>
+#include <Particule/P3D/Pipeline/Frustum.hpp>
+#include <memory>
+
+namespace Particule::P3D {
+
+    using namespace Particule::Core;
+    using namespace Particule::Engine;
+
+    // À placer à côté d'un Camera : possède le framebuffer 3D de cette caméra.
+    // Le premier MeshRenderer de la frame l'ouvre (BeginFrame : effacement, projection), les suivants
+    // y dessinent directement ; l'image est présentée et la frame fermée dans OnRenderImage.
+    class Camera3D : public Component
+    {
+    private:
+        std::unique_ptr<Framebuffer> m_framebuffer;
+        std::unique_ptr<Rasterizer> m_rasterizer;
+        int m_focal;
+        Frustum m_frustum;
+        bool m_frameOpen;
+    public:
+        int fieldOfView;                      // Vertical, en degrés
+        fixed12_32 nearClip;
+        fixed12_32 farClip;
+        Color clearColor;
+        Vector3<fixed12_32> lightDirection;   // Direction de la lumière (monde, normalisée)
+        uint8_t ambient;                      // Lumière ambiante 0..255
+        RasterStats lastFrameStats;
+
+        Camera3D(GameObject& gameObject);
+        ~Camera3D() override;
+
+        // Renvoie le rasterizer de la frame ; au premier appel de la frame, prépare le framebuffer
+        // à la taille de la fenêtre courante, l'efface et calcule la projection
+        Rasterizer* BeginFrame();
+
+        inline Framebuffer* framebuffer() noexcept { return m_framebuffer.get(); }
+        inline int focal() const noexcept { return m_focal; }
+        // Pyramide de vue de la frame courante (valide après BeginFrame)
+        inline const Frustum& frustum() const noexcept { return m_frustum; }
+
+        void OnDisable() override;
+        void OnRenderImage(Camera* camera) override;
+    };
+
+}
+
+#endif // P3D_COMPO_CAMERA3D_HPP
@@ -0,0 +1,36 @@
+#ifndef P3D_COMPO_MESHRENDERER_HPP
+#define P3D_COMPO_MESHRENDERER_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+#include <Particule/P3D/Mesh.hpp>
+#include <Particule/P3D/Raster/Rasterizer.hpp>
+#include <vector>
+
+namespace Particule::P3D {
+
+    using namespace Particule::Core;
+    using namespace Particule::Engine;
+
+    // Dessine un Mesh dans le framebuffer du Camera3D de la caméra qui rend
+    class MeshRenderer : public Component
+    {
+    private:
+        VertexBuffer m_viewPositions;
+        VertexBuffer m_viewNormals;
+        std::vector<uint32_t> m_colors;
+        std::vector<ColorRaw> m_faceColors;
+    public:
+        Mesh* mesh;          // Non possédé
+        Texture* texture;    // Non possédée ; utilisée si le mesh a des uv (rendu non éclairé)
+        ShadeMode shading;
+        CullMode cullMode;
+
+        MeshRenderer(GameObject& gameObject, Mesh* mesh = nullptr);
+
+        void OnRenderObject(Camera* camera) override;
+    };
+
+}
+
+#endif // P3D_COMPO_MESHRENDERER_HPP
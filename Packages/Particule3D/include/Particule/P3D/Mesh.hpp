@@ -0,0 +1,49 @@
+#ifndef P3D_MESH_HPP
+#define P3D_MESH_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/P3D/Pipeline/VertexBuffer.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Particule::P3D {
+
+    using namespace Particule::Core;
+
+    // Maillage indexé (3 index par triangle, faces avant dans le sens horaire : normale = (b - a) x (c - a))
+    struct Mesh
+    {
+        std::vector<Vector3<fixed12_32>> vertices;
+        std::vector<Vector3<fixed12_32>> normals;   // Un par sommet, recalculé si absent
+        std::vector<Color> colors;                  // Optionnel : un par sommet
+        std::vector<Vector2<fixed12_32>> uv;        // Optionnel : un par sommet (0..1, répété au-delà)
+        std::vector<uint16_t> triangles;
+        Color color = Color::White;                 // Utilisée si colors est vide
+
+        // Données préparées par UploadMeshData : sphère englobante (espace objet) et copies SoA
+        Vector3<fixed12_32> boundsCenter;
+        fixed12_32 boundsRadius;
+        VertexBuffer vertexBuffer;
+        VertexBuffer normalBuffer;
+        VertexBuffer faceNormalBuffer;              // Un par triangle (nulle si ses index sont hors des sommets)
+
+        inline size_t TriangleCount() const noexcept { return triangles.size() / 3; }
+
+        // Normales moyennées des faces adjacentes
+        void RecalculateNormals();
+
+        // Sphère englobante centrée sur la boîte englobante des sommets
+        void RecalculateBounds();
+
+        // À appeler après modification des sommets ou des triangles : normales manquantes, bornes et tampons SoA
+        void UploadMeshData();
+
+        // Normale unitaire de la face (a, b, c)
+        static Vector3<fixed12_32> FaceNormal(const Vector3<fixed12_32>& a, const Vector3<fixed12_32>& b, const Vector3<fixed12_32>& c);
+
+        static Mesh CreateCube(fixed12_32 size);
+    };
+
+}
+
+#endif // P3D_MESH_HPP
@@ -0,0 +1,12 @@
+#ifndef PARTICULE_3D_HPP
+#define PARTICULE_3D_HPP
+
+#include <Particule/P3D/Mesh.hpp>
+#include <Particule/P3D/Pipeline/VertexBuffer.hpp>
+#include <Particule/P3D/Pipeline/Frustum.hpp>
+#include <Particule/P3D/Raster/Framebuffer.hpp>
+#include <Particule/P3D/Raster/Rasterizer.hpp>
+#include <Particule/P3D/Components/Camera3D.hpp>
+#include <Particule/P3D/Components/MeshRenderer.hpp>
+
+#endif // PARTICULE_3D_HPP
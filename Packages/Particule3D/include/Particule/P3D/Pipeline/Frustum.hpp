@@ -0,0 +1,39 @@
+#ifndef P3D_PIPELINE_FRUSTUM_HPP
+#define P3D_PIPELINE_FRUSTUM_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <cstdint>
+
+namespace Particule::P3D {
+
+    using namespace Particule::Core;
+
+    /*
+    Pyramide de vue en espace caméra (x à droite, y en haut, z vers l'avant), en entiers.
+    Chaque plan a*x + b*y + c*z + d >= 0 garde sa norme |(a, b, c)| pour tester des sphères sans normaliser.
+    */
+    class Frustum
+    {
+    public:
+        Frustum() = default;
+
+        // Même projection que Rasterizer::SetProjection, pour un écran width x height
+        void Set(int focal, int width, int height, fixed12_32 nearClip, fixed12_32 farClip);
+
+        // Faux seulement si la sphère est entièrement hors d'un plan
+        bool IntersectsSphere(const Vector3<fixed12_32>& center, fixed12_32 radius) const;
+
+    private:
+        struct Plane
+        {
+            int32_t a, b, c;
+            int64_t d;      // raw fixed12_32 multiplié par la norme
+            int64_t length; // |(a, b, c)|
+        };
+
+        Plane m_planes[6]{};
+    };
+
+}
+
+#endif // P3D_PIPELINE_FRUSTUM_HPP
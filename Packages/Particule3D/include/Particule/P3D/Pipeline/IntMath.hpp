@@ -0,0 +1,25 @@
+#ifndef P3D_PIPELINE_INTMATH_HPP
+#define P3D_PIPELINE_INTMATH_HPP
+
+#include <cstdint>
+
+namespace Particule::P3D {
+
+    // Racine carrée entière 64 bits
+    inline uint64_t ISqrt64(uint64_t v)
+    {
+        uint64_t res = 0;
+        uint64_t bit = uint64_t(1) << 62;
+        while (bit > v) bit >>= 2;
+        while (bit != 0)
+        {
+            if (v >= res + bit) { v -= res + bit; res = (res >> 1) + bit; }
+            else res >>= 1;
+            bit >>= 2;
+        }
+        return res;
+    }
+
+}
+
+#endif // P3D_PIPELINE_INTMATH_HPP
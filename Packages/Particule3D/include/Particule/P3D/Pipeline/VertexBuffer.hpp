@@ -0,0 +1,66 @@
+#ifndef P3D_PIPELINE_VERTEXBUFFER_HPP
+#define P3D_PIPELINE_VERTEXBUFFER_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Particule::P3D {
+
+    using namespace Particule::Core;
+
+    // Sommets en structure de tableaux (valeurs raw fixed12_32) : x, y et z contigus pour les traitements par lots
+    struct VertexBuffer
+    {
+        std::vector<int32_t> x;
+        std::vector<int32_t> y;
+        std::vector<int32_t> z;
+
+        inline size_t size() const noexcept { return x.size(); }
+        inline bool empty() const noexcept { return x.empty(); }
+
+        inline void resize(size_t count)
+        {
+            x.resize(count);
+            y.resize(count);
+            z.resize(count);
+        }
+
+        inline void Set(size_t i, const Vector3<fixed12_32>& v) noexcept
+        {
+            x[i] = v.x.raw(); y[i] = v.y.raw(); z[i] = v.z.raw();
+        }
+
+        inline Vector3<fixed12_32> Get(size_t i) const noexcept
+        {
+            return { fixed12_32::from_raw(x[i]), fixed12_32::from_raw(y[i]), fixed12_32::from_raw(z[i]) };
+        }
+
+        void Assign(const std::vector<Vector3<fixed12_32>>& points)
+        {
+            resize(points.size());
+            for (size_t i = 0; i < points.size(); ++i)
+                Set(i, points[i]);
+        }
+
+        // this = matrix * src (points, avec translation)
+        inline void TransformPoints(const Mat4<fixed12_32>& matrix, const VertexBuffer& src)
+        {
+            resize(src.size());
+            Particule::Core::TransformPoints(matrix, src.x.data(), src.y.data(), src.z.data(), src.size(),
+                                             x.data(), y.data(), z.data());
+        }
+
+        // this = matrix * src (directions, sans translation)
+        inline void TransformDirections(const Mat4<fixed12_32>& matrix, const VertexBuffer& src)
+        {
+            resize(src.size());
+            Particule::Core::TransformDirections(matrix, src.x.data(), src.y.data(), src.z.data(), src.size(),
+                                                 x.data(), y.data(), z.data());
+        }
+    };
+
+}
+
+#endif // P3D_PIPELINE_VERTEXBUFFER_HPP
@@ -0,0 +1,48 @@
+#ifndef P3D_RASTER_FRAMEBUFFER_HPP
+#define P3D_RASTER_FRAMEBUFFER_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace Particule::P3D {
+
+    using namespace Particule::Core;
+
+    // Cible de rendu logiciel : couleur au format natif (ColorRaw : RGB565 sur Casio, RGBA8888 en SDL2)
+    // et z-buffer 16 bits. La profondeur est "inversée" : 0 = vide / infini, plus grand = plus proche.
+    // Si la fenêtre expose sa mémoire vidéo (Window::VideoMemory, VRAM Casio) et a la taille du framebuffer,
+    // la couleur y est écrite directement : seul le z-buffer est alloué et Present n'a rien à copier.
+    // Sinon (SDL2) la couleur est gardée en mémoire et envoyée dans une texture par Present.
+    class Framebuffer
+    {
+    private:
+        int m_width;
+        int m_height;
+        Window* m_window;   // Fenêtre dont la mémoire vidéo sert de couleur, nullptr sinon
+        std::vector<ColorRaw> m_color;
+        std::vector<uint16_t> m_depth;
+        Texture* m_texture; // Créée au premier Present (nécessite une fenêtre)
+
+        Framebuffer(const Framebuffer&) = delete;
+        Framebuffer& operator=(const Framebuffer&) = delete;
+    public:
+        Framebuffer(int width, int height);
+        ~Framebuffer();
+
+        inline int Width() const noexcept { return m_width; }
+        inline int Height() const noexcept { return m_height; }
+        // Relue à chaque frame : la VRAM change d'adresse avec le triple buffering
+        inline ColorRaw* ColorData() noexcept { return m_window != nullptr ? m_window->VideoMemory() : m_color.data(); }
+        inline uint16_t* DepthData() noexcept { return m_depth.data(); }
+
+        void Clear(ColorRaw color);
+        void ClearDepth();
+
+        // Copie le framebuffer dans sa texture puis la dessine à l'écran (rien à faire en mémoire vidéo)
+        void Present(int x, int y);
+    };
+
+}
+
+#endif // P3D_RASTER_FRAMEBUFFER_HPP
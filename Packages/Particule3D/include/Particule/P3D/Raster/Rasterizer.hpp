@@ -0,0 +1,127 @@
+#ifndef P3D_RASTER_RASTERIZER_HPP
+#define P3D_RASTER_RASTERIZER_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/P3D/Raster/Framebuffer.hpp>
+#include <Particule/P3D/Pipeline/VertexBuffer.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Particule::P3D {
+
+    using namespace Particule::Core;
+
+    enum class CullMode : uint8_t { None, Back, Front };
+    enum class ShadeMode : uint8_t { Flat, Gouraud };
+
+    // Sommet en espace caméra : x à droite, y en haut, z vers l'avant (fixed12_32)
+    struct ViewVertex
+    {
+        Vector3<fixed12_32> position;
+        uint8_t r, g, b;
+    };
+
+    // Sommet projeté : x / y en pixels 28.4, profondeur 16 bits inversée, couleur 8 bits par canal,
+    // w = z caméra (raw) et u / v en texels (TextureSpan::UV_BITS bits de fraction) pour le texturage
+    struct ScreenVertex
+    {
+        int32_t x, y;
+        int32_t depth;
+        int32_t r, g, b;
+        int32_t w;
+        int32_t u, v;
+    };
+
+    struct RasterStats
+    {
+        uint32_t submitted = 0;
+        uint32_t culled = 0;
+        uint32_t clipped = 0;
+        uint32_t drawn = 0;
+        uint32_t objectsCulled = 0; // Objets entiers rejetés par la pyramide de vue
+    };
+
+    /*
+    Rasterizer triangle entier (aucun flottant sur le chemin critique, adapté au SH4 sans FPU).
+      - fonctions d'arête en 28.4 avec règle top-left
+      - profondeur en 1/z (affine à l'écran) sur 16 bits, interpolation incrémentale
+      - ombrage plat ou Gouraud
+      - élimination des faces arrière (faces avant : sens horaire vu de la caméra, comme Unity)
+      - découpage Sutherland-Hodgman sur near / far et une bande de garde autour de l'écran
+      - texturage optionnel (texture != nullptr) corrigé en perspective par sous-spans (Texture::DrawSpan)
+    */
+    class Rasterizer
+    {
+    public:
+        static constexpr int SUBPIXEL_BITS = 4;
+        // Étendue max (pixels) de la bande de garde : garde les fonctions d'arête dans un int32
+        static constexpr int MAX_EXTENT = 2880;
+        static constexpr int32_t DEPTH_MIN = 0x0100;
+        static constexpr int32_t DEPTH_MAX = 0xFF00;
+
+        CullMode cullMode = CullMode::Back;
+        Texture* texture = nullptr; // Non possédée ; remplace la couleur des sommets si définie
+        RasterStats stats;
+
+        explicit Rasterizer(Framebuffer& target);
+
+        // focal : distance focale en pixels, near / far : plans de découpage en espace caméra
+        void SetProjection(int focal, fixed12_32 nearClip, fixed12_32 farClip);
+
+        // Dessine une liste indexée de triangles (3 index par triangle) à partir de sommets caméra en SoA.
+        // colors : un 0xRRGGBB par sommet. En ShadeMode::Flat, faceColors donne une couleur par triangle
+        // (sinon la couleur du premier sommet). uvs (un par sommet, 0..1) n'est lu que si texture est définie.
+        void DrawIndexed(const VertexBuffer& positions, const uint32_t* colors,
+                         const uint16_t* indices, size_t indexCount,
+                         ShadeMode mode, const ColorRaw* faceColors = nullptr,
+                         const Vector2<fixed12_32>* uvs = nullptr);
+
+        // Dessine un triangle en espace caméra (découpage + projection)
+        void DrawTriangle(const ViewVertex& a, const ViewVertex& b, const ViewVertex& c,
+                          ShadeMode mode, ColorRaw flatColor);
+
+        // Dessine un triangle déjà projeté et entièrement dans la bande de garde
+        void RasterizeTriangle(const ScreenVertex& a, const ScreenVertex& b, const ScreenVertex& c,
+                               ShadeMode mode, ColorRaw flatColor);
+
+    private:
+        struct ClipVertex
+        {
+            int64_t x, y, w; // x / w et y / w donnent les pixels, w = z caméra (raw)
+            int32_t r, g, b;
+            int32_t u, v;    // Texels
+        };
+
+        enum : uint8_t
+        {
+            CLIP_NEAR   = 1 << 0,
+            CLIP_FAR    = 1 << 1,
+            CLIP_LEFT   = 1 << 2,
+            CLIP_RIGHT  = 1 << 3,
+            CLIP_TOP    = 1 << 4,
+            CLIP_BOTTOM = 1 << 5,
+        };
+
+        Framebuffer& m_target;
+        int m_focal;
+        int64_t m_near;
+        int64_t m_far;
+        int m_guard;
+
+        std::vector<ClipVertex> m_clip;
+        std::vector<ScreenVertex> m_screen;
+        std::vector<uint8_t> m_outcodes;
+
+        ClipVertex ToClip(int64_t x, int64_t y, int64_t z, int32_t r, int32_t g, int32_t b,
+                          int32_t u = 0, int32_t v = 0) const;
+        uint8_t Outcode(const ClipVertex& v) const;
+        int64_t PlaneDistance(const ClipVertex& v, uint8_t plane) const;
+        ScreenVertex Project(const ClipVertex& v) const;
+        void DrawClipped(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c,
+                         uint8_t outcodes, ShadeMode mode, ColorRaw flatColor);
+    };
+
+}
+
+#endif // P3D_RASTER_RASTERIZER_HPP
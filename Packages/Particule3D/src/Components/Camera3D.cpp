@@ -0,0 +1,63 @@
+#include <Particule/P3D/Components/Camera3D.hpp>
+#include <Particule/Engine/Components/Camera.hpp>
+
+namespace Particule::P3D {
+
+    Camera3D::Camera3D(GameObject& gameObject)
+        : Component(gameObject), m_focal(1), m_frameOpen(false),
+          fieldOfView(60),
+          nearClip(fixed12_32(1) / 10),
+          farClip(fixed12_32(100)),
+          clearColor(Color::Black),
+          lightDirection(fixed12_32(0), fixed12_32(-1), fixed12_32(0)),
+          ambient(64)
+    {
+    }
+
+    Camera3D::~Camera3D() = default;
+
+    Rasterizer* Camera3D::BeginFrame()
+    {
+        if (m_frameOpen) return m_rasterizer.get();
+        Window* window = Window::GetCurrentWindow();
+        if (window == nullptr) return nullptr;
+        const int width = window->Width();
+        const int height = window->Height();
+        if (width <= 0 || height <= 0) return nullptr;
+
+        if (!m_framebuffer || m_framebuffer->Width() != width || m_framebuffer->Height() != height)
+        {
+            m_rasterizer.reset();
+            m_framebuffer = std::make_unique<Framebuffer>(width, height);
+            m_rasterizer = std::make_unique<Rasterizer>(*m_framebuffer);
+        }
+
+        // focale = (h / 2) / tan(fov / 2)
+        const fixed12_32 half = fixed12_32(fieldOfView) * fixed12_32::constant(MY_PI) / 360;
+        const fixed12_32 tanHalf = fixed12_32::sin(half) / fixed12_32::cos(half);
+        m_focal = tanHalf > fixed12_32::zero() ? static_cast<int>(fixed12_32(height / 2) / tanHalf) : height;
+        if (m_focal < 1) m_focal = 1;
+        m_rasterizer->SetProjection(m_focal, nearClip, farClip);
+        m_frustum.Set(m_focal, width, height, nearClip, farClip);
+        // Effacé ici plutôt qu'après Present : en mémoire vidéo, l'image doit rester jusqu'à l'affichage
+        m_framebuffer->Clear(clearColor.Raw());
+        m_framebuffer->ClearDepth();
+        m_frameOpen = true;
+        return m_rasterizer.get();
+    }
+
+    void Camera3D::OnDisable()
+    {
+        m_frameOpen = false;
+    }
+
+    void Camera3D::OnRenderImage(Camera* camera)
+    {
+        if (camera == nullptr || &camera->gameObject != &gameObject || !m_frameOpen) return;
+        m_frameOpen = false;
+        m_framebuffer->Present(0, 0);
+        lastFrameStats = m_rasterizer->stats;
+        m_rasterizer->stats = RasterStats{};
+    }
+
+}
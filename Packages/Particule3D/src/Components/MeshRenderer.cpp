@@ -0,0 +1,131 @@
+#include <Particule/P3D/Components/MeshRenderer.hpp>
+#include <Particule/P3D/Components/Camera3D.hpp>
+#include <Particule/Engine/Components/Camera.hpp>
+#include <algorithm>
+
+namespace Particule::P3D {
+
+    namespace {
+
+        // Intensité 0..255 : ambiante + diffuse (Lambert), vecteurs raw fixed12_32
+        inline uint32_t Shade(int32_t nx, int32_t ny, int32_t nz, const int32_t toLight[3], uint32_t ambient)
+        {
+            const int64_t d = (static_cast<int64_t>(nx) * toLight[0] + static_cast<int64_t>(ny) * toLight[1]
+                             + static_cast<int64_t>(nz) * toLight[2]) >> 12;
+            if (d <= 0) return ambient;
+            return ambient + (((255 - ambient) * static_cast<uint32_t>(d > 4096 ? 4096 : d)) >> 12);
+        }
+
+        inline uint32_t PackRGB(uint32_t r, uint32_t g, uint32_t b)
+        {
+            return (r << 16) | (g << 8) | b;
+        }
+
+        inline fixed12_32 MaxAbs(const Vector3<fixed12_32>& v)
+        {
+            return std::max({ v.x.abs(), v.y.abs(), v.z.abs() });
+        }
+
+    }
+
+    MeshRenderer::MeshRenderer(GameObject& gameObject, Mesh* mesh)
+        : Component(gameObject), mesh(mesh), texture(nullptr), shading(ShadeMode::Gouraud), cullMode(CullMode::Back)
+    {
+    }
+
+    void MeshRenderer::OnRenderObject(Camera* camera)
+    {
+        if (mesh == nullptr || camera == nullptr || mesh->vertices.empty()) return;
+        Camera3D* camera3D = camera->gameObject.GetComponent<Camera3D>();
+        if (camera3D == nullptr) return;
+        Rasterizer* rasterizer = camera3D->BeginFrame();
+        if (rasterizer == nullptr) return;
+
+        const size_t count = mesh->vertices.size();
+        if (mesh->vertexBuffer.size() != count || mesh->normalBuffer.size() != count
+            || mesh->faceNormalBuffer.size() != mesh->TriangleCount())
+            mesh->UploadMeshData();
+
+        // Objet -> caméra : une matrice par objet, puis transformation par lots des sommets
+        const Transform& self = gameObject.transform;
+        const Transform& eye = camera->gameObject.transform;
+        const Mat4<fixed12_32> view = eye.worldToViewMatrix();
+        const Mat4<fixed12_32> modelView = view * self.localToWorldMatrix();
+
+        // Rejet de l'objet entier par sa sphère englobante avant tout travail par sommet
+        const Vector3<fixed12_32> center = modelView.multiplyPoint(mesh->boundsCenter);
+        const fixed12_32 radius = mesh->boundsRadius * MaxAbs(self.scale);
+        if (!camera3D->frustum().IntersectsSphere(center, radius))
+        {
+            ++rasterizer->stats.objectsCulled;
+            return;
+        }
+
+        m_viewPositions.TransformPoints(modelView, mesh->vertexBuffer);
+
+        // Les normales ne suivent que la rotation
+        const Mat4<fixed12_32> normalMatrix = Mat4<fixed12_32>::rotate(eye.worldRotationQuat().conjugate() * self.worldRotationQuat());
+        const Vector3<fixed12_32> light = -view.multiplyVector(camera3D->lightDirection);
+        const int32_t toLight[3] = { light.x.raw(), light.y.raw(), light.z.raw() };
+        const uint32_t ambient = camera3D->ambient;
+
+        // Texturé : les texels remplacent la couleur, pas d'éclairage à calculer
+        const bool textured = texture != nullptr && mesh->uv.size() == count;
+        const bool gouraud = shading == ShadeMode::Gouraud && !textured;
+        const bool perVertexColor = mesh->colors.size() == count;
+        m_colors.resize(count);
+        if (textured)
+            std::fill(m_colors.begin(), m_colors.end(), 0xFFFFFFu);
+        else if (gouraud)
+        {
+            m_viewNormals.TransformDirections(normalMatrix, mesh->normalBuffer);
+            const int32_t* nx = m_viewNormals.x.data();
+            const int32_t* ny = m_viewNormals.y.data();
+            const int32_t* nz = m_viewNormals.z.data();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Color& base = perVertexColor ? mesh->colors[i] : mesh->color;
+                const uint32_t l = Shade(nx[i], ny[i], nz[i], toLight, ambient);
+                m_colors[i] = PackRGB(ColorKernels::Mul8(base.R(), l), ColorKernels::Mul8(base.G(), l), ColorKernels::Mul8(base.B(), l));
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Color& base = perVertexColor ? mesh->colors[i] : mesh->color;
+                m_colors[i] = PackRGB(base.R(), base.G(), base.B());
+            }
+        }
+
+        const ColorRaw* faceColors = nullptr;
+        if (!gouraud && !textured)
+        {
+            // Normales de face précalculées par UploadMeshData : seule la rotation de l'objet est appliquée
+            m_viewNormals.TransformDirections(normalMatrix, mesh->faceNormalBuffer);
+            const int32_t* nx = m_viewNormals.x.data();
+            const int32_t* ny = m_viewNormals.y.data();
+            const int32_t* nz = m_viewNormals.z.data();
+            const size_t faces = mesh->TriangleCount();
+            m_faceColors.resize(faces);
+            for (size_t f = 0; f < faces; ++f)
+            {
+                const uint16_t i0 = mesh->triangles[f * 3], i1 = mesh->triangles[f * 3 + 1], i2 = mesh->triangles[f * 3 + 2];
+                if (i0 >= count || i1 >= count || i2 >= count) continue;
+                const uint32_t l = Shade(nx[f], ny[f], nz[f], toLight, ambient);
+                const uint32_t rgb = m_colors[i0];
+                m_faceColors[f] = Color(static_cast<unsigned char>(ColorKernels::Mul8((rgb >> 16) & 0xFF, l)),
+                                        static_cast<unsigned char>(ColorKernels::Mul8((rgb >> 8) & 0xFF, l)),
+                                        static_cast<unsigned char>(ColorKernels::Mul8(rgb & 0xFF, l))).Raw();
+            }
+            faceColors = m_faceColors.data();
+        }
+
+        rasterizer->cullMode = cullMode;
+        rasterizer->texture = textured ? texture : nullptr;
+        rasterizer->DrawIndexed(m_viewPositions, m_colors.data(), mesh->triangles.data(), mesh->triangles.size(), shading, faceColors,
+                                textured ? mesh->uv.data() : nullptr);
+        rasterizer->texture = nullptr;
+    }
+
+}
@@ -0,0 +1,142 @@
+#include <Particule/P3D/Mesh.hpp>
+#include <Particule/P3D/Pipeline/IntMath.hpp>
+#include <cstdlib>
+#include <algorithm>
+
+namespace Particule::P3D {
+
+    namespace {
+
+        // Normalise un vecteur raw 64 bits sans perte sur les petites faces
+        Vector3<fixed12_32> Normalize(int64_t x, int64_t y, int64_t z)
+        {
+            while (std::llabs(x) >= (int64_t(1) << 20) || std::llabs(y) >= (int64_t(1) << 20) || std::llabs(z) >= (int64_t(1) << 20))
+            {
+                x >>= 1; y >>= 1; z >>= 1;
+            }
+            const int64_t len = static_cast<int64_t>(ISqrt64(static_cast<uint64_t>(x * x + y * y + z * z)));
+            if (len == 0) return Vector3<fixed12_32>{};
+            return Vector3<fixed12_32>(fixed12_32::from_raw(static_cast<int32_t>((x << 12) / len)),
+                                       fixed12_32::from_raw(static_cast<int32_t>((y << 12) / len)),
+                                       fixed12_32::from_raw(static_cast<int32_t>((z << 12) / len)));
+        }
+
+    }
+
+    Vector3<fixed12_32> Mesh::FaceNormal(const Vector3<fixed12_32>& a, const Vector3<fixed12_32>& b, const Vector3<fixed12_32>& c)
+    {
+        const int64_t ux = (b.x - a.x).raw(), uy = (b.y - a.y).raw(), uz = (b.z - a.z).raw();
+        const int64_t vx = (c.x - a.x).raw(), vy = (c.y - a.y).raw(), vz = (c.z - a.z).raw();
+        return Normalize(uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx);
+    }
+
+    void Mesh::RecalculateNormals()
+    {
+        std::vector<int64_t> acc(vertices.size() * 3, 0);
+        for (size_t t = 0; t + 2 < triangles.size(); t += 3)
+        {
+            const uint16_t i0 = triangles[t], i1 = triangles[t + 1], i2 = triangles[t + 2];
+            if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) continue;
+            const Vector3<fixed12_32> n = FaceNormal(vertices[i0], vertices[i1], vertices[i2]);
+            for (uint16_t i : { i0, i1, i2 })
+            {
+                acc[i * 3 + 0] += n.x.raw();
+                acc[i * 3 + 1] += n.y.raw();
+                acc[i * 3 + 2] += n.z.raw();
+            }
+        }
+        normals.resize(vertices.size());
+        for (size_t i = 0; i < vertices.size(); ++i)
+            normals[i] = Normalize(acc[i * 3 + 0], acc[i * 3 + 1], acc[i * 3 + 2]);
+    }
+
+    void Mesh::RecalculateBounds()
+    {
+        if (vertices.empty())
+        {
+            boundsCenter = Vector3<fixed12_32>{};
+            boundsRadius = fixed12_32(0);
+            return;
+        }
+        Vector3<fixed12_32> lo = vertices[0], hi = vertices[0];
+        for (const Vector3<fixed12_32>& v : vertices)
+        {
+            lo.x = std::min(lo.x, v.x); lo.y = std::min(lo.y, v.y); lo.z = std::min(lo.z, v.z);
+            hi.x = std::max(hi.x, v.x); hi.y = std::max(hi.y, v.y); hi.z = std::max(hi.z, v.z);
+        }
+        boundsCenter = Vector3<fixed12_32>(fixed12_32::from_raw(static_cast<int32_t>((static_cast<int64_t>(lo.x.raw()) + hi.x.raw()) / 2)),
+                                           fixed12_32::from_raw(static_cast<int32_t>((static_cast<int64_t>(lo.y.raw()) + hi.y.raw()) / 2)),
+                                           fixed12_32::from_raw(static_cast<int32_t>((static_cast<int64_t>(lo.z.raw()) + hi.z.raw()) / 2)));
+        uint64_t maxSq = 0;
+        for (const Vector3<fixed12_32>& v : vertices)
+        {
+            const int64_t dx = static_cast<int64_t>(v.x.raw()) - boundsCenter.x.raw();
+            const int64_t dy = static_cast<int64_t>(v.y.raw()) - boundsCenter.y.raw();
+            const int64_t dz = static_cast<int64_t>(v.z.raw()) - boundsCenter.z.raw();
+            maxSq = std::max(maxSq, static_cast<uint64_t>(dx * dx + dy * dy + dz * dz));
+        }
+        // +1 : la racine entière est arrondie par défaut
+        boundsRadius = fixed12_32::from_raw(static_cast<int32_t>(ISqrt64(maxSq) + 1));
+    }
+
+    void Mesh::UploadMeshData()
+    {
+        if (normals.size() != vertices.size())
+            RecalculateNormals();
+        RecalculateBounds();
+        vertexBuffer.Assign(vertices);
+        normalBuffer.Assign(normals);
+        // Normales de face pour le rendu plat : tournées par objet chaque frame, jamais recalculées
+        faceNormalBuffer.resize(TriangleCount());
+        for (size_t f = 0; f < TriangleCount(); ++f)
+        {
+            const uint16_t i0 = triangles[f * 3], i1 = triangles[f * 3 + 1], i2 = triangles[f * 3 + 2];
+            const bool valid = i0 < vertices.size() && i1 < vertices.size() && i2 < vertices.size();
+            faceNormalBuffer.Set(f, valid ? FaceNormal(vertices[i0], vertices[i1], vertices[i2]) : Vector3<fixed12_32>{});
+        }
+    }
+
+    Mesh Mesh::CreateCube(fixed12_32 size)
+    {
+        const fixed12_32 h = size / 2;
+        const fixed12_32 one(1);
+        const fixed12_32 zero(0);
+        // Normale puis deux axes (u, v) tels que u x v = normale
+        const Vector3<fixed12_32> faces[6][3] = {
+            { {  one, zero, zero }, { zero,  one, zero }, { zero, zero,  one } },
+            { { -one, zero, zero }, { zero, zero,  one }, { zero,  one, zero } },
+            { { zero,  one, zero }, { zero, zero,  one }, {  one, zero, zero } },
+            { { zero, -one, zero }, {  one, zero, zero }, { zero, zero,  one } },
+            { { zero, zero,  one }, {  one, zero, zero }, { zero,  one, zero } },
+            { { zero, zero, -one }, { zero,  one, zero }, {  one, zero, zero } },
+        };
+
+        Mesh mesh;
+        mesh.vertices.reserve(24);
+        mesh.normals.reserve(24);
+        mesh.uv.reserve(24);
+        mesh.triangles.reserve(36);
+        for (const auto& face : faces)
+        {
+            const Vector3<fixed12_32> n = face[0] * h;
+            const Vector3<fixed12_32> u = face[1] * h;
+            const Vector3<fixed12_32> v = face[2] * h;
+            const uint16_t base = static_cast<uint16_t>(mesh.vertices.size());
+            mesh.vertices.push_back(n - u - v);
+            mesh.vertices.push_back(n + u - v);
+            mesh.vertices.push_back(n + u + v);
+            mesh.vertices.push_back(n - u + v);
+            for (int i = 0; i < 4; ++i)
+                mesh.normals.push_back(face[0]);
+            mesh.uv.push_back({ zero, one });
+            mesh.uv.push_back({ one, one });
+            mesh.uv.push_back({ one, zero });
+            mesh.uv.push_back({ zero, zero });
+            for (uint16_t i : { 0, 1, 2, 0, 2, 3 })
+                mesh.triangles.push_back(base + i);
+        }
+        mesh.UploadMeshData();
+        return mesh;
+    }
+
+}
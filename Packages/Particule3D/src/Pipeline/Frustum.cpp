@@ -0,0 +1,44 @@
+#include <Particule/P3D/Pipeline/Frustum.hpp>
+#include <Particule/P3D/Pipeline/IntMath.hpp>
+
+namespace Particule::P3D {
+
+    namespace {
+
+        inline int64_t Length(int32_t a, int32_t b, int32_t c)
+        {
+            return static_cast<int64_t>(ISqrt64(static_cast<uint64_t>(
+                static_cast<int64_t>(a) * a + static_cast<int64_t>(b) * b + static_cast<int64_t>(c) * c)));
+        }
+
+    }
+
+    void Frustum::Set(int focal, int width, int height, fixed12_32 nearClip, fixed12_32 farClip)
+    {
+        const int32_t cx = width / 2;
+        const int32_t cy = height / 2;
+        // Bords de l'écran : x * focal / z compris dans [-cx, cx], y * focal / z dans [-cy, cy]
+        m_planes[0] = { focal, 0, cx, 0, 0 };   // gauche
+        m_planes[1] = { -focal, 0, cx, 0, 0 };  // droite
+        m_planes[2] = { 0, -focal, cy, 0, 0 };  // haut
+        m_planes[3] = { 0, focal, cy, 0, 0 };   // bas
+        m_planes[4] = { 0, 0, 1, -static_cast<int64_t>(nearClip.raw()), 0 };
+        m_planes[5] = { 0, 0, -1, static_cast<int64_t>(farClip.raw()), 0 };
+        for (Plane& p : m_planes)
+            p.length = Length(p.a, p.b, p.c);
+    }
+
+    bool Frustum::IntersectsSphere(const Vector3<fixed12_32>& center, fixed12_32 radius) const
+    {
+        const int64_t x = center.x.raw(), y = center.y.raw(), z = center.z.raw();
+        const int64_t r = radius.raw();
+        for (const Plane& p : m_planes)
+        {
+            // Distance signée * |n| < -rayon * |n| : entièrement derrière le plan
+            if (p.a * x + p.b * y + p.c * z + p.d < -r * p.length)
+                return false;
+        }
+        return true;
+    }
+
+}
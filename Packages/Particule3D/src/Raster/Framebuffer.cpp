@@ -0,0 +1,52 @@
+#include <Particule/P3D/Raster/Framebuffer.hpp>
+#include <algorithm>
+
+namespace Particule::P3D {
+
+    Framebuffer::Framebuffer(int width, int height)
+        : m_width(width), m_height(height),
+          m_window(nullptr),
+          m_depth(static_cast<size_t>(width) * height, 0),
+          m_texture(nullptr)
+    {
+        Window* window = Window::GetCurrentWindow();
+        if (window != nullptr && window->VideoMemory() != nullptr && window->Width() == width && window->Height() == height)
+            m_window = window;
+        else
+            m_color.assign(static_cast<size_t>(width) * height, 0);
+    }
+
+    Framebuffer::~Framebuffer()
+    {
+        if (m_texture != nullptr)
+            Texture::Unload(m_texture);
+    }
+
+    void Framebuffer::Clear(ColorRaw color)
+    {
+        ColorRaw* data = ColorData();
+        std::fill(data, data + static_cast<size_t>(m_width) * m_height, color);
+    }
+
+    void Framebuffer::ClearDepth()
+    {
+        std::fill(m_depth.begin(), m_depth.end(), static_cast<uint16_t>(0));
+    }
+
+    void Framebuffer::Present(int x, int y)
+    {
+        if (m_window != nullptr) return;
+        if (m_texture == nullptr)
+        {
+            m_texture = Texture::Create(m_width, m_height);
+            if (m_texture == nullptr) return;
+        }
+        const ColorRaw* src = m_color.data();
+        for (int j = 0; j < m_height; ++j)
+            for (int i = 0; i < m_width; ++i)
+                m_texture->WritePixelRaw(i, j, *src++);
+        m_texture->UpdateTexture();
+        m_texture->Draw(x, y);
+    }
+
+}
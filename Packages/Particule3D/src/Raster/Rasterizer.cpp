@@ -0,0 +1,463 @@
+#include <Particule/P3D/Raster/Rasterizer.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace Particule::P3D {
+
+    namespace {
+
+        constexpr int SUB = Rasterizer::SUBPIXEL_BITS;
+        constexpr int DEPTH_FRAC = 8;   // Profondeur interpolée en 24.8
+        constexpr int COLOR_FRAC = 16;  // Couleurs interpolées en 16.16
+        constexpr int Q_BITS = 18;      // Amplitude max de q (1/z) par triangle texturé
+
+        struct Gradient
+        {
+            int32_t start, dx, dy;
+        };
+
+        // Gradient d'un attribut à partir des fonctions d'arête (valeurs au premier pixel et pas par pixel)
+        inline Gradient SetupGradient(const int64_t w[3], const int64_t ax[3], const int64_t ay[3],
+                                      int32_t c0, int32_t c1, int32_t c2, int frac, int64_t area, int32_t bias)
+        {
+            Gradient g;
+            g.start = static_cast<int32_t>(((w[0] * c0 + w[1] * c1 + w[2] * c2) << frac) / area) + bias;
+            g.dx = static_cast<int32_t>(((ax[0] * c0 + ax[1] * c1 + ax[2] * c2) << frac) / area);
+            g.dy = static_cast<int32_t>(((ay[0] * c0 + ay[1] * c1 + ay[2] * c2) << frac) / area);
+            return g;
+        }
+
+        // Règle top-left : les arêtes du haut et de gauche possèdent leurs pixels
+        inline int32_t TopLeftBias(const ScreenVertex& a, const ScreenVertex& b)
+        {
+            const int32_t dy = b.y - a.y;
+            const int32_t dx = b.x - a.x;
+            return (dy < 0 || (dy == 0 && dx > 0)) ? 0 : -1;
+        }
+
+        inline int64_t EdgeAt(const ScreenVertex& a, const ScreenVertex& b, int64_t px, int64_t py)
+        {
+            return static_cast<int64_t>(b.x - a.x) * (py - a.y) - static_cast<int64_t>(b.y - a.y) * (px - a.x);
+        }
+
+        // Boîte englobante et fonctions d'arête d'un triangle, évaluées au centre du premier pixel
+        struct TriangleSetup
+        {
+            int minX, minY, maxX, maxY;
+            int64_t px, py;                 // Premier centre de pixel (28.4)
+            int64_t w[3], ax[3], ay[3];     // Fonctions d'arête et pas par pixel (64 bits)
+            int32_t e[3], edx[3], edy[3];   // Mêmes valeurs avec la règle top-left, pour le parcours
+        };
+
+        // v0, v1, v2 dans le sens horaire à l'écran. Faux si aucun centre de pixel n'est couvert par la boîte.
+        bool SetupTriangle(const Framebuffer& fb, const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2,
+                           TriangleSetup& t)
+        {
+            // Pixels dont le centre est dans la boîte englobante
+            t.minX = std::max((std::min({v0.x, v1.x, v2.x}) + 7) >> SUB, 0);
+            t.minY = std::max((std::min({v0.y, v1.y, v2.y}) + 7) >> SUB, 0);
+            t.maxX = std::min((std::max({v0.x, v1.x, v2.x}) - 8) >> SUB, fb.Width() - 1);
+            t.maxY = std::min((std::max({v0.y, v1.y, v2.y}) - 8) >> SUB, fb.Height() - 1);
+            if (t.minX > t.maxX || t.minY > t.maxY) return false;
+
+            t.px = (static_cast<int64_t>(t.minX) << SUB) + (1 << (SUB - 1));
+            t.py = (static_cast<int64_t>(t.minY) << SUB) + (1 << (SUB - 1));
+
+            t.w[0] = EdgeAt(v1, v2, t.px, t.py);
+            t.w[1] = EdgeAt(v2, v0, t.px, t.py);
+            t.w[2] = EdgeAt(v0, v1, t.px, t.py);
+            t.ax[0] = static_cast<int64_t>(v1.y - v2.y) << SUB;
+            t.ax[1] = static_cast<int64_t>(v2.y - v0.y) << SUB;
+            t.ax[2] = static_cast<int64_t>(v0.y - v1.y) << SUB;
+            t.ay[0] = static_cast<int64_t>(v2.x - v1.x) << SUB;
+            t.ay[1] = static_cast<int64_t>(v0.x - v2.x) << SUB;
+            t.ay[2] = static_cast<int64_t>(v1.x - v0.x) << SUB;
+
+            // Valeurs bornées par la bande de garde : le reste du parcours tient dans des int32
+            t.e[0] = static_cast<int32_t>(t.w[0]) + TopLeftBias(v1, v2);
+            t.e[1] = static_cast<int32_t>(t.w[1]) + TopLeftBias(v2, v0);
+            t.e[2] = static_cast<int32_t>(t.w[2]) + TopLeftBias(v0, v1);
+            for (int i = 0; i < 3; ++i)
+            {
+                t.edx[i] = static_cast<int32_t>(t.ax[i]);
+                t.edy[i] = static_cast<int32_t>(t.ay[i]);
+            }
+            return true;
+        }
+
+        // v0, v1, v2 dans le sens horaire à l'écran (area > 0)
+        template<bool GOURAUD>
+        void RasterizeImpl(Framebuffer& fb, const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2,
+                           int64_t area, ColorRaw flatColor)
+        {
+            TriangleSetup t;
+            if (!SetupTriangle(fb, v0, v1, v2, t)) return;
+            const int width = fb.Width();
+            const int minX = t.minX, minY = t.minY, maxX = t.maxX, maxY = t.maxY;
+            const int64_t* w = t.w;
+            const int64_t* ax = t.ax;
+            const int64_t* ay = t.ay;
+            int32_t e0Row = t.e[0], e1Row = t.e[1], e2Row = t.e[2];
+            const int32_t e0dx = t.edx[0], e1dx = t.edx[1], e2dx = t.edx[2];
+            const int32_t e0dy = t.edy[0], e1dy = t.edy[1], e2dy = t.edy[2];
+
+            const Gradient z = SetupGradient(w, ax, ay, v0.depth, v1.depth, v2.depth, DEPTH_FRAC, area, 1 << (DEPTH_FRAC - 1));
+            Gradient r{}, g{}, b{};
+            if constexpr (GOURAUD)
+            {
+                constexpr int32_t half = 1 << (COLOR_FRAC - 1);
+                r = SetupGradient(w, ax, ay, v0.r, v1.r, v2.r, COLOR_FRAC, area, half);
+                g = SetupGradient(w, ax, ay, v0.g, v1.g, v2.g, COLOR_FRAC, area, half);
+                b = SetupGradient(w, ax, ay, v0.b, v1.b, v2.b, COLOR_FRAC, area, half);
+            }
+
+            int32_t zRow = z.start, rRow = r.start, gRow = g.start, bRow = b.start;
+            ColorRaw* colorRow = fb.ColorData() + minY * width + minX;
+            uint16_t* depthRow = fb.DepthData() + minY * width + minX;
+
+            for (int y = minY; y <= maxY; ++y)
+            {
+                int32_t e0 = e0Row, e1 = e1Row, e2 = e2Row;
+                int32_t zi = zRow, ri = rRow, gi = gRow, bi = bRow;
+                ColorRaw* cp = colorRow;
+                uint16_t* dp = depthRow;
+                bool inside = false;
+
+                for (int x = minX; x <= maxX; ++x)
+                {
+                    if ((e0 | e1 | e2) >= 0)
+                    {
+                        inside = true;
+                        const uint16_t d = static_cast<uint16_t>(zi >> DEPTH_FRAC);
+                        if (d > *dp)
+                        {
+                            *dp = d;
+                            if constexpr (GOURAUD)
+                                *cp = Color(static_cast<unsigned char>(ri >> COLOR_FRAC),
+                                            static_cast<unsigned char>(gi >> COLOR_FRAC),
+                                            static_cast<unsigned char>(bi >> COLOR_FRAC)).Raw();
+                            else
+                                *cp = flatColor;
+                        }
+                    }
+                    else if (inside)
+                        break; // Triangle convexe : plus rien à droite sur cette ligne
+
+                    e0 += e0dx; e1 += e1dx; e2 += e2dx;
+                    zi += z.dx;
+                    if constexpr (GOURAUD) { ri += r.dx; gi += g.dx; bi += b.dx; }
+                    ++cp; ++dp;
+                }
+
+                e0Row += e0dy; e1Row += e1dy; e2Row += e2dy;
+                zRow += z.dy;
+                if constexpr (GOURAUD) { rRow += r.dy; gRow += g.dy; bRow += b.dy; }
+                colorRow += width;
+                depthRow += width;
+            }
+        }
+
+        // Plan d'un attribut c (valeurs c0..c2 aux sommets) : valeur au premier pixel et pas par pixel, en 64 bits
+        struct Plane64
+        {
+            int64_t start, dx, dy;
+        };
+
+        inline Plane64 SetupPlane(const TriangleSetup& t, const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2,
+                                  int64_t c0, int64_t c1, int64_t c2, int64_t area)
+        {
+            const int64_t dx1 = v1.x - v0.x, dy1 = v1.y - v0.y;
+            const int64_t dx2 = v2.x - v0.x, dy2 = v2.y - v0.y;
+            const int64_t dc1 = c1 - c0, dc2 = c2 - c0;
+            Plane64 p;
+            p.dx = ((dc1 * dy2 - dc2 * dy1) << SUB) / area;
+            p.dy = ((dc2 * dx1 - dc1 * dx2) << SUB) / area;
+            p.start = c0 + ((p.dx * (t.px - v0.x) + p.dy * (t.py - v0.y)) >> SUB);
+            return p;
+        }
+
+        // Triangle texturé : un span par ligne, délégué à Texture::DrawSpan (correction perspective par sous-spans)
+        void RasterizeTexturedImpl(Framebuffer& fb, Texture* texture, const ScreenVertex& v0, const ScreenVertex& v1, const ScreenVertex& v2,
+                                   int64_t area)
+        {
+            TriangleSetup t;
+            if (!SetupTriangle(fb, v0, v1, v2, t)) return;
+            const int width = fb.Width();
+
+            const Gradient z = SetupGradient(t.w, t.ax, t.ay, v0.depth, v1.depth, v2.depth, DEPTH_FRAC, area, 1 << (DEPTH_FRAC - 1));
+
+            // q proportionnel à 1/z, normalisé par triangle pour que u*q et ses gradients tiennent dans 64 bits
+            int64_t q[3] = {
+                (int64_t(1) << 40) / std::max(1, v0.w),
+                (int64_t(1) << 40) / std::max(1, v1.w),
+                (int64_t(1) << 40) / std::max(1, v2.w) };
+            const int64_t qMax = std::max({ q[0], q[1], q[2] });
+            int shift = 0;
+            while ((qMax >> shift) >= (int64_t(1) << Q_BITS)) ++shift;
+            for (int64_t& qi : q) qi = std::max<int64_t>(1, qi >> shift);
+
+            const Plane64 pq = SetupPlane(t, v0, v1, v2, q[0], q[1], q[2], area);
+            const Plane64 pu = SetupPlane(t, v0, v1, v2, v0.u * q[0], v1.u * q[1], v2.u * q[2], area);
+            const Plane64 pv = SetupPlane(t, v0, v1, v2, v0.v * q[0], v1.v * q[1], v2.v * q[2], area);
+
+            TextureSpan span;
+            span.duq = pu.dx; span.dvq = pv.dx; span.dq = pq.dx;
+            span.ddepth = z.dx;
+
+            int32_t e0Row = t.e[0], e1Row = t.e[1], e2Row = t.e[2];
+            ColorRaw* colorRow = fb.ColorData() + t.minY * width;
+            uint16_t* depthRow = fb.DepthData() + t.minY * width;
+
+            for (int y = t.minY; y <= t.maxY; ++y)
+            {
+                int32_t e0 = e0Row, e1 = e1Row, e2 = e2Row;
+                int x = t.minX;
+                while (x <= t.maxX && (e0 | e1 | e2) < 0)
+                {
+                    e0 += t.edx[0]; e1 += t.edx[1]; e2 += t.edx[2];
+                    ++x;
+                }
+                const int start = x;
+                while (x <= t.maxX && (e0 | e1 | e2) >= 0)
+                {
+                    e0 += t.edx[0]; e1 += t.edx[1]; e2 += t.edx[2];
+                    ++x;
+                }
+
+                if (x > start)
+                {
+                    const int64_t col = start - t.minX;
+                    const int64_t row = y - t.minY;
+                    span.uq = pu.start + pu.dx * col + pu.dy * row;
+                    span.vq = pv.start + pv.dx * col + pv.dy * row;
+                    span.q = pq.start + pq.dx * col + pq.dy * row;
+                    span.depth = static_cast<int32_t>(z.start + static_cast<int64_t>(z.dx) * col + static_cast<int64_t>(z.dy) * row);
+                    texture->DrawSpan(colorRow + start, depthRow + start, x - start, span);
+                }
+
+                e0Row += t.edy[0]; e1Row += t.edy[1]; e2Row += t.edy[2];
+                colorRow += width;
+                depthRow += width;
+            }
+        }
+
+        inline ColorRaw PackColor(int32_t r, int32_t g, int32_t b)
+        {
+            return Color(static_cast<unsigned char>(r), static_cast<unsigned char>(g), static_cast<unsigned char>(b)).Raw();
+        }
+
+    }
+
+    Rasterizer::Rasterizer(Framebuffer& target)
+        : m_target(target), m_focal(1), m_near(0), m_far(0), m_guard(0)
+    {
+        SetProjection(std::max(1, target.Height()), fixed12_32(1) / 10, fixed12_32(100));
+    }
+
+    void Rasterizer::SetProjection(int focal, fixed12_32 nearClip, fixed12_32 farClip)
+    {
+        m_focal = focal;
+        m_near = std::max<int64_t>(1, nearClip.raw());
+        m_far = std::max<int64_t>(m_near + 1, farClip.raw());
+        m_guard = std::max(0, (MAX_EXTENT - std::max(m_target.Width(), m_target.Height())) / 2);
+    }
+
+    Rasterizer::ClipVertex Rasterizer::ToClip(int64_t x, int64_t y, int64_t z, int32_t r, int32_t g, int32_t b,
+                                              int32_t u, int32_t v) const
+    {
+        ClipVertex c;
+        c.x = x * m_focal + z * (m_target.Width() / 2);
+        c.y = z * (m_target.Height() / 2) - y * m_focal;
+        c.w = z;
+        c.r = r; c.g = g; c.b = b;
+        c.u = u; c.v = v;
+        return c;
+    }
+
+    int64_t Rasterizer::PlaneDistance(const ClipVertex& v, uint8_t plane) const
+    {
+        switch (plane)
+        {
+            case CLIP_NEAR:   return v.w - m_near;
+            case CLIP_FAR:    return m_far - v.w;
+            case CLIP_LEFT:   return v.x + m_guard * v.w;
+            case CLIP_RIGHT:  return (m_target.Width() + m_guard) * v.w - v.x;
+            case CLIP_TOP:    return v.y + m_guard * v.w;
+            case CLIP_BOTTOM: return (m_target.Height() + m_guard) * v.w - v.y;
+            default:          return 0;
+        }
+    }
+
+    uint8_t Rasterizer::Outcode(const ClipVertex& v) const
+    {
+        uint8_t code = 0;
+        for (uint8_t plane = CLIP_NEAR; plane <= CLIP_BOTTOM; plane <<= 1)
+            if (PlaneDistance(v, plane) < 0)
+                code |= plane;
+        return code;
+    }
+
+    ScreenVertex Rasterizer::Project(const ClipVertex& v) const
+    {
+        ScreenVertex s;
+        s.x = static_cast<int32_t>((v.x << SUB) / v.w);
+        s.y = static_cast<int32_t>((v.y << SUB) / v.w);
+        // 1/z ramené sur [DEPTH_MIN, DEPTH_MAX] entre far et near
+        const int64_t num = (m_far - v.w) * m_near * (DEPTH_MAX - DEPTH_MIN);
+        const int64_t den = v.w * (m_far - m_near);
+        s.depth = DEPTH_MIN + static_cast<int32_t>(num / den);
+        s.r = v.r; s.g = v.g; s.b = v.b;
+        s.w = static_cast<int32_t>(v.w);
+        s.u = v.u; s.v = v.v;
+        return s;
+    }
+
+    void Rasterizer::RasterizeTriangle(const ScreenVertex& a, const ScreenVertex& b, const ScreenVertex& c,
+                                       ShadeMode mode, ColorRaw flatColor)
+    {
+        int64_t area = static_cast<int64_t>(b.x - a.x) * (c.y - a.y) - static_cast<int64_t>(b.y - a.y) * (c.x - a.x);
+        // Écran y vers le bas : une face avant (sens horaire vue caméra) a une aire positive
+        const bool back = area < 0;
+        if (area == 0
+            || (cullMode == CullMode::Back && back)
+            || (cullMode == CullMode::Front && !back))
+        {
+            ++stats.culled;
+            return;
+        }
+        ++stats.drawn;
+
+        const ScreenVertex* v1 = &b;
+        const ScreenVertex* v2 = &c;
+        if (area < 0)
+        {
+            std::swap(v1, v2);
+            area = -area;
+        }
+        if (texture != nullptr)
+            RasterizeTexturedImpl(m_target, texture, a, *v1, *v2, area);
+        else if (mode == ShadeMode::Gouraud)
+            RasterizeImpl<true>(m_target, a, *v1, *v2, area, flatColor);
+        else
+            RasterizeImpl<false>(m_target, a, *v1, *v2, area, flatColor);
+    }
+
+    void Rasterizer::DrawClipped(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c,
+                                 uint8_t outcodes, ShadeMode mode, ColorRaw flatColor)
+    {
+        ++stats.clipped;
+        ClipVertex bufferA[12];
+        ClipVertex bufferB[12];
+        ClipVertex* in = bufferA;
+        ClipVertex* out = bufferB;
+        in[0] = a; in[1] = b; in[2] = c;
+        int count = 3;
+
+        // Sutherland-Hodgman, uniquement sur les plans franchis
+        for (uint8_t plane = CLIP_NEAR; plane <= CLIP_BOTTOM; plane <<= 1)
+        {
+            if (!(outcodes & plane)) continue;
+            int n = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                const ClipVertex& cur = in[i];
+                const ClipVertex& next = in[(i + 1) % count];
+                const int64_t dc = PlaneDistance(cur, plane);
+                const int64_t dn = PlaneDistance(next, plane);
+                if (dc >= 0)
+                    out[n++] = cur;
+                if ((dc >= 0) != (dn >= 0))
+                {
+                    // Toujours interpolé depuis le sommet intérieur : arêtes partagées identiques
+                    const ClipVertex& from = dc >= 0 ? cur : next;
+                    const ClipVertex& to = dc >= 0 ? next : cur;
+                    const int64_t df = dc >= 0 ? dc : dn;
+                    const int64_t dt = dc >= 0 ? dn : dc;
+                    const int64_t t = (df << 16) / (df - dt);
+                    ClipVertex& v = out[n++];
+                    v.x = from.x + (((to.x - from.x) * t) >> 16);
+                    v.y = from.y + (((to.y - from.y) * t) >> 16);
+                    v.w = from.w + (((to.w - from.w) * t) >> 16);
+                    v.r = from.r + static_cast<int32_t>(((to.r - from.r) * t) >> 16);
+                    v.g = from.g + static_cast<int32_t>(((to.g - from.g) * t) >> 16);
+                    v.b = from.b + static_cast<int32_t>(((to.b - from.b) * t) >> 16);
+                    v.u = from.u + static_cast<int32_t>((static_cast<int64_t>(to.u - from.u) * t) >> 16);
+                    v.v = from.v + static_cast<int32_t>((static_cast<int64_t>(to.v - from.v) * t) >> 16);
+                }
+            }
+            std::swap(in, out);
+            count = n;
+            if (count < 3) return;
+        }
+
+        ScreenVertex projected[12];
+        for (int i = 0; i < count; ++i)
+            projected[i] = Project(in[i]);
+        for (int i = 1; i + 1 < count; ++i)
+            RasterizeTriangle(projected[0], projected[i], projected[i + 1], mode, flatColor);
+    }
+
+    void Rasterizer::DrawTriangle(const ViewVertex& a, const ViewVertex& b, const ViewVertex& c,
+                                  ShadeMode mode, ColorRaw flatColor)
+    {
+        ++stats.submitted;
+        const ClipVertex ca = ToClip(a.position.x.raw(), a.position.y.raw(), a.position.z.raw(), a.r, a.g, a.b);
+        const ClipVertex cb = ToClip(b.position.x.raw(), b.position.y.raw(), b.position.z.raw(), b.r, b.g, b.b);
+        const ClipVertex cc = ToClip(c.position.x.raw(), c.position.y.raw(), c.position.z.raw(), c.r, c.g, c.b);
+        const uint8_t oa = Outcode(ca), ob = Outcode(cb), oc = Outcode(cc);
+        if (oa & ob & oc) { ++stats.culled; return; }
+        if ((oa | ob | oc) == 0)
+            RasterizeTriangle(Project(ca), Project(cb), Project(cc), mode, flatColor);
+        else
+            DrawClipped(ca, cb, cc, oa | ob | oc, mode, flatColor);
+    }
+
+    void Rasterizer::DrawIndexed(const VertexBuffer& positions, const uint32_t* colors,
+                                 const uint16_t* indices, size_t indexCount,
+                                 ShadeMode mode, const ColorRaw* faceColors, const Vector2<fixed12_32>* uvs)
+    {
+        const size_t vertexCount = positions.size();
+        const int32_t* px = positions.x.data();
+        const int32_t* py = positions.y.data();
+        const int32_t* pz = positions.z.data();
+        const bool textured = texture != nullptr && uvs != nullptr;
+        const int32_t texW = textured ? texture->Width() : 0;
+        const int32_t texH = textured ? texture->Height() : 0;
+        m_clip.resize(vertexCount);
+        m_screen.resize(vertexCount);
+        m_outcodes.resize(vertexCount);
+
+        // Chaque sommet est transformé et projeté une seule fois
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            const uint32_t rgb = colors[i];
+            // UV 0..1 (fixed12_32) -> texels avec TextureSpan::UV_BITS bits de fraction
+            const int32_t u = textured ? uvs[i].x.raw() * texW : 0;
+            const int32_t v = textured ? uvs[i].y.raw() * texH : 0;
+            m_clip[i] = ToClip(px[i], py[i], pz[i], (rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF, u, v);
+            m_outcodes[i] = Outcode(m_clip[i]);
+            if (m_outcodes[i] == 0)
+                m_screen[i] = Project(m_clip[i]);
+        }
+
+        for (size_t t = 0; t + 2 < indexCount; t += 3)
+        {
+            const uint16_t i0 = indices[t], i1 = indices[t + 1], i2 = indices[t + 2];
+            if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) continue;
+            ++stats.submitted;
+
+            const uint8_t o0 = m_outcodes[i0], o1 = m_outcodes[i1], o2 = m_outcodes[i2];
+            if (o0 & o1 & o2) { ++stats.culled; continue; }
+
+            const ColorRaw flat = (mode == ShadeMode::Flat && faceColors != nullptr)
+                ? faceColors[t / 3]
+                : PackColor(m_clip[i0].r, m_clip[i0].g, m_clip[i0].b);
+
+            if ((o0 | o1 | o2) == 0)
+                RasterizeTriangle(m_screen[i0], m_screen[i1], m_screen[i2], mode, flat);
+            else
+                DrawClipped(m_clip[i0], m_clip[i1], m_clip[i2], o0 | o1 | o2, mode, flat);
+        }
+    }
+
+}
@@ -2,18 +2,57 @@
 #define COMPO_CAMERA_HPP
 #include <Particule/Core/ParticuleCore.hpp>
 #include <Particule/Engine/Core/Component.hpp>
+#include <Particule/Engine/Core/Bounds2D.hpp>
+#include <Particule/Engine/Enum/Layer.hpp>
+#include <vector>
 
 namespace Particule::Engine {
 
+    /*
+    Vue 2D : la position monde du GameObject (x, y) est au centre de viewport, zoom donne les pixels
+    par unité monde. Les composants dont le layer n'est pas dans cullingMask, ou dont les bornes
+    (Component::GetRenderBounds) sont hors de ViewRect, ne sont ni rendus ni extraits.
+    Cull fait une fois par frame une requête SpatialHash::OverlapBox de la zone visible par scène et
+    marque les GameObjects trouvés. La grille n'est qu'une phase large, pour les GameObjects dont un
+    SpatialBody englobe le rendu (SpatialBody::SetEnclosesRendering) : non trouvés, leurs composants à
+    bornes sont écartés ; trouvés, ils passent encore par leurs propres bornes. Un composant sans bornes
+    n'est jamais écarté.
+    */
     class Camera : public Component
     {
+    private:
+        static uint32_t s_stamp;        // dernier marquage, toutes caméras confondues
+        uint32_t m_stamp = 0;           // marquage de ce Cull (0 : aucun)
+        Bounds2D m_culled;              // zone marquée par ce Cull
+        std::vector<Component*> m_found; // résultats de la grille, gardé d'une frame à l'autre
+
     public:
         static Camera *main;
+
+        Rect viewport{ 0, 0, 0, 0 };     // zone de l'écran en pixels ; vide : pas de test de bornes
+        bool fitWindow = true;           // viewport recalé sur la fenêtre principale à chaque frame
+        fixed12_32 zoom = fixed12_32(1); // pixels par unité monde
+        uint32_t cullingMask = ~uint32_t(0); // LayerBit des layers rendus
+
         Camera(GameObject& gameObject);
         ~Camera() override;
+
+        // Thread principal : viewport = fenêtre principale si fitWindow
+        void FitWindow();
+        // Zone monde visible, calculée depuis le transform
+        [[nodiscard]] Bounds2D ViewRect() const;
+        [[nodiscard]] Vector2<int> WorldToScreen(const Vector2<fixed12_32>& world) const;
+        [[nodiscard]] Vector2<fixed12_32> ScreenToWorld(int x, int y) const;
+        // ViewRect, après marquage des GameObjects dont un SpatialBody la recouvre ; une fois par frame, avant les IsVisible
+        Bounds2D Cull();
+        // Zone du dernier Cull, pour les IsVisible suivants de la même frame
+        [[nodiscard]] inline const Bounds2D& culledView() const noexcept { return m_culled; }
+        // Layer dans cullingMask et bornes (s'il en a) dans view ; marquage de Cull si view en vient
+        [[nodiscard]] bool IsVisible(const Component& component, const Bounds2D& view) const;
+
         void Render();
     };
 
 }
 
-#endif // COMPO_CAMERA_HPP
\ No newline at end of file
+#endif // COMPO_CAMERA_HPP
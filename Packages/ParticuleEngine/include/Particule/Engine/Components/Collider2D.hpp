@@ -0,0 +1,85 @@
+#ifndef COMPO_COLLIDER2D_HPP
+#define COMPO_COLLIDER2D_HPP
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+#include <Particule/Engine/Core/Physics2D.hpp>
+
+namespace Particule::Engine {
+
+    class Rigidbody2D;
+
+    enum class ColliderShape2D : uint8_t { Box, Circle };
+
+    /*
+    Forme de collision inscrite dans le PhysicsWorld2D de la scène tant que le composant est actif.
+    Rattachée au Rigidbody2D actif du même GameObject, sinon statique à la position du transform.
+    L'échelle et la rotation du transform sont ignorées.
+    */
+    class Collider2D : public Component
+    {
+    private:
+        PhysicsHandle m_handle;
+        ColliderShape2D m_shape;
+        Vector2<fixed16_32> m_offset;
+        fixed16_32 m_friction = fixed16_32::constant(0.4L);
+        fixed16_32 m_bounciness = fixed16_32(0);
+        uint32_t m_collisionMask = ~uint32_t(0);
+        friend class PhysicsWorld2D;
+
+        void Unregister() noexcept;
+
+    protected:
+        Collider2D(GameObject& gameObject, ColliderShape2D shape, const Vector2<fixed16_32>& offset);
+        // Après un changement de géométrie ou de matériau
+        void Refresh();
+
+    public:
+        ~Collider2D() override;
+
+        void OnEnable() override;
+        void OnDisable() override;
+
+        [[nodiscard]] inline ColliderShape2D shape() const noexcept { return m_shape; }
+        [[nodiscard]] inline const Vector2<fixed16_32>& offset() const noexcept { return m_offset; }
+        [[nodiscard]] inline fixed16_32 friction() const noexcept { return m_friction; }
+        [[nodiscard]] inline fixed16_32 bounciness() const noexcept { return m_bounciness; }
+        [[nodiscard]] inline uint32_t collisionMask() const noexcept { return m_collisionMask; }
+        // Corps auquel le collider est rattaché, nullptr s'il est statique
+        [[nodiscard]] Rigidbody2D* attachedRigidbody() const noexcept;
+
+        void SetOffset(const Vector2<fixed16_32>& offset);
+        // Frottement de Coulomb (moyenne des deux colliders) et rebond (maximum des deux), entre 0 et 1
+        void SetMaterial(fixed16_32 friction, fixed16_32 bounciness);
+        // LayerBit des layers touchés ; un contact demande que chacun accepte le layer de l'autre
+        void SetCollisionMask(uint32_t mask);
+    };
+
+    class BoxCollider2D final : public Collider2D
+    {
+    private:
+        Vector2<fixed16_32> m_size;
+
+    public:
+        BoxCollider2D(GameObject& gameObject, const Vector2<fixed16_32>& size,
+                      const Vector2<fixed16_32>& offset = Vector2<fixed16_32>(fixed16_32(0), fixed16_32(0)));
+
+        [[nodiscard]] inline const Vector2<fixed16_32>& size() const noexcept { return m_size; }
+        void SetSize(const Vector2<fixed16_32>& size);
+    };
+
+    class CircleCollider2D final : public Collider2D
+    {
+    private:
+        fixed16_32 m_radius;
+
+    public:
+        CircleCollider2D(GameObject& gameObject, fixed16_32 radius,
+                         const Vector2<fixed16_32>& offset = Vector2<fixed16_32>(fixed16_32(0), fixed16_32(0)));
+
+        [[nodiscard]] inline fixed16_32 radius() const noexcept { return m_radius; }
+        void SetRadius(fixed16_32 radius);
+    };
+
+}
+
+#endif // COMPO_COLLIDER2D_HPP
@@ -0,0 +1,71 @@
+#ifndef COMPO_RIGIDBODY2D_HPP
+#define COMPO_RIGIDBODY2D_HPP
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+#include <Particule/Engine/Core/Physics2D.hpp>
+
+namespace Particule::Engine {
+
+    enum class BodyType2D : uint8_t
+    {
+        Dynamic,   // soumis à la gravité, aux forces et aux contacts
+        Kinematic  // déplacé par sa seule vitesse, masse infinie pour les contacts
+    };
+
+    /*
+    Corps simulé par le PhysicsWorld2D de la scène (sans rotation) ; ses Collider2D s'y rattachent.
+    La position simulée est gardée en fixed16_32 et recopiée dans le transform après chaque pas ;
+    écrire la position du transform entre deux pas téléporte le corps.
+    */
+    class Rigidbody2D : public Component
+    {
+    private:
+        PhysicsHandle m_handle;
+        Vector2<fixed16_32> m_position;
+        Vector2<fixed16_32> m_velocity;
+        Vector2<fixed16_32> m_force;    // accumulée jusqu'au prochain pas
+        Vector2<fixed12_32> m_written;  // position écrite dans le transform au dernier pas
+        fixed16_32 m_mass;
+        fixed16_32 m_invMass;
+        uint32_t m_firstShape = PhysicsWorld2D::NONE; // colliders rattachés, chaînés par le monde
+        uint16_t m_restFrames = 0;      // pas consécutifs sous PhysicsWorld2D::sleepSpeed
+        bool m_awake = true;
+        friend class PhysicsWorld2D;
+
+        void Unregister() noexcept;
+
+    public:
+        BodyType2D bodyType = BodyType2D::Dynamic;
+        fixed16_32 gravityScale = fixed16_32(1);
+        fixed16_32 drag = fixed16_32(0); // amortissement de la vitesse, par seconde
+        bool allowSleep = true;
+
+        explicit Rigidbody2D(GameObject& gameObject, fixed16_32 mass = fixed16_32(1));
+        ~Rigidbody2D() override;
+
+        void OnEnable() override;
+        void OnDisable() override;
+
+        [[nodiscard]] inline const Vector2<fixed16_32>& position() const noexcept { return m_position; }
+        [[nodiscard]] inline const Vector2<fixed16_32>& velocity() const noexcept { return m_velocity; }
+        [[nodiscard]] inline fixed16_32 mass() const noexcept { return m_mass; }
+        [[nodiscard]] inline bool IsAwake() const noexcept { return m_awake; }
+        [[nodiscard]] inline bool isDynamic() const noexcept { return bodyType == BodyType2D::Dynamic; }
+        // Masse effective dans les contacts : 0 pour un corps cinématique
+        [[nodiscard]] inline fixed16_32 inverseMass() const noexcept { return isDynamic() ? m_invMass : fixed16_32(0); }
+
+        void SetMass(fixed16_32 mass);
+        void SetVelocity(const Vector2<fixed16_32>& velocity);
+        // Appliquée pendant le prochain pas
+        void AddForce(const Vector2<fixed16_32>& force);
+        // Changement de vitesse immédiat : impulse / masse
+        void AddImpulse(const Vector2<fixed16_32>& impulse);
+        // Téléporte le corps et son transform
+        void MovePosition(const Vector2<fixed16_32>& position);
+        void WakeUp() noexcept;
+        void Sleep() noexcept;
+    };
+
+}
+
+#endif // COMPO_RIGIDBODY2D_HPP
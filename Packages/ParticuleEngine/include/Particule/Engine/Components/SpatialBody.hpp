@@ -0,0 +1,38 @@
+#ifndef COMPO_SPATIAL_BODY_HPP
+#define COMPO_SPATIAL_BODY_HPP
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+#include <Particule/Engine/Core/SpatialHash.hpp>
+
+namespace Particule::Engine {
+
+    // Inscrit une boîte (relative au GameObject) dans le SpatialHash de sa scène tant que le composant est actif
+    class SpatialBody : public Component
+    {
+    private:
+        SpatialProxy m_proxy;
+        Bounds2D m_bounds;
+        bool m_enclosesRendering = false;
+
+        void Unregister() noexcept;
+
+    public:
+        SpatialBody(GameObject& gameObject, const Bounds2D& bounds);
+        ~SpatialBody() override;
+
+        void OnEnable() override;
+        void OnDisable() override;
+
+        [[nodiscard]] inline const Bounds2D& bounds() const noexcept { return m_bounds; }
+        void SetBounds(const Bounds2D& bounds);
+        // La boîte englobe tout le rendu du GameObject : Camera::Cull écarte alors ses composants à bornes
+        // quand elle est hors de la vue. À laisser faux si un sprite ou un autre rendu peut en dépasser
+        [[nodiscard]] inline bool enclosesRendering() const noexcept { return m_enclosesRendering; }
+        void SetEnclosesRendering(bool encloses);
+        // Boîte monde à la dernière mise à jour de la grille
+        [[nodiscard]] Bounds2D worldBounds() const;
+    };
+
+}
+
+#endif // COMPO_SPATIAL_BODY_HPP
@@ -0,0 +1,39 @@
+#ifndef PE_CORE_BOUNDS2D_HPP
+#define PE_CORE_BOUNDS2D_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+
+namespace Particule::Engine {
+
+    using namespace Particule::Core;
+
+    // Boîte alignée sur les axes en coordonnées monde (1 unité = 1 pixel à zoom 1, y vers le bas)
+    struct Bounds2D
+    {
+        Vector2<fixed12_32> min;
+        Vector2<fixed12_32> max;
+
+        static constexpr Bounds2D FromCenter(const Vector2<fixed12_32>& center, const Vector2<fixed12_32>& halfSize)
+        {
+            return Bounds2D{ { center.x - halfSize.x, center.y - halfSize.y }, { center.x + halfSize.x, center.y + halfSize.y } };
+        }
+
+        [[nodiscard]] constexpr Vector2<fixed12_32> center() const { return { (min.x + max.x) / 2, (min.y + max.y) / 2 }; }
+        [[nodiscard]] constexpr Vector2<fixed12_32> size() const { return { max.x - min.x, max.y - min.y }; }
+
+        // Bords inclus : deux boîtes qui se touchent se recouvrent
+        [[nodiscard]] constexpr bool Overlaps(const Bounds2D& other) const
+        {
+            return min.x <= other.max.x && other.min.x <= max.x
+                && min.y <= other.max.y && other.min.y <= max.y;
+        }
+
+        [[nodiscard]] constexpr bool Contains(const Vector2<fixed12_32>& point) const
+        {
+            return min.x <= point.x && point.x <= max.x && min.y <= point.y && point.y <= max.y;
+        }
+    };
+
+}
+
+#endif // PE_CORE_BOUNDS2D_HPP
@@ -0,0 +1,57 @@
+#ifndef PE_CORE_COMMAND_BUFFER_HPP
+#define PE_CORE_COMMAND_BUFFER_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <vector>
+#include <functional>
+
+namespace Particule::Engine {
+
+    using namespace Particule::Core;
+
+    class Component;
+    class GameObject;
+    class Transform;
+    class Scene;
+    class Prefab;
+
+    /*
+    Changements structurels demandés pendant la phase ParallelUpdate, rejoués sur le thread principal
+    juste après (SceneManager::MainLoop). Une file par thread du JobSystem, donc sans verrou :
+    les commandes sont rejouées dans l'ordre des threads, puis dans l'ordre des appels.
+
+        void Bullet::ParallelUpdate() {
+            if (life-- == 0) SceneManager::sceneManager->commands().Destroy(&gameObject);
+        }
+    */
+    class CommandBuffer
+    {
+    private:
+        std::vector<std::vector<std::function<void()>>> m_lanes;
+
+    public:
+        CommandBuffer() : m_lanes(1) {}
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        // Une file par thread du JobSystem ; appelé sur le thread principal avant la phase parallèle
+        void Begin();
+        // Exécute puis vide les commandes (thread principal)
+        void Apply();
+
+        void Push(std::function<void()> command);
+
+        void Destroy(Component* component);
+        void Destroy(GameObject* go);
+        void SetActive(GameObject* go, bool value);
+        void SetEnabled(Component* component, bool value);
+        void SetParent(Transform* transform, Transform* parent, bool keepWorld = true);
+        // then(instance) est appelé juste après l'instanciation
+        void Instantiate(Scene* scene, const Prefab* prefab, const Vector3<fixed12_32>& position,
+                         std::function<void(GameObject&)> then = {});
+        void Despawn(GameObject* go);
+    };
+
+}
+
+#endif // PE_CORE_COMMAND_BUFFER_HPP
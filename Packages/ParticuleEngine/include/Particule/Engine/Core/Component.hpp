@@ -4,21 +4,49 @@
 #include <Particule/Engine/Core/Object.hpp>
 #include <Particule/Engine/Core/GameObject.hpp>
 #include <Particule/Engine/Core/Transform.hpp>
+#include <Particule/Engine/Core/ComponentType.hpp>
+#include <Particule/Engine/Core/ComponentHooks.hpp>
+#include <Particule/Engine/Core/ComponentPool.hpp>
+#include <Particule/Engine/Core/SceneArena.hpp>
+#include <Particule/Engine/Core/Bounds2D.hpp>
 #include <Particule/Engine/Core/Coroutine/CoroutineManager.hpp>
 #include <stdio.h>
 #include <cstdarg>
 #include <memory>
+#include <algorithm>
+#include <type_traits>
 
 namespace Particule::Engine {
 
     using namespace Particule::Core;
 
     class Camera;
+    class RenderSnapshot;
+    struct Collision2D;
 
     class Component : public Object
     {
     private:
         bool m_enabled;
+        ComponentTypeId m_typeId = 0; // type concret, fixé par AddComponent
+        uint8_t m_hookMask = 0;       // hooks redéfinis par le type concret (HookBit)
+        int32_t m_hookSlot[COMPONENT_HOOK_COUNT];
+        ComponentHooks* m_hookOwner = nullptr; // listes de la scène où le composant est inscrit
+        ComponentPoolBase* m_pool = nullptr;   // pool d'origine (nullptr : alloué par new)
+        uint32_t m_poolSlot = 0;
+        SceneArena* m_arena = nullptr;         // arena de la scène si alloué dedans
+        bool m_destroyed = false;              // Destroy demandé, retiré en fin de frame
+        friend class GameObject;
+        friend class ComponentHooks;
+        friend class Scene;
+        friend class SceneManager;
+        friend struct ComponentDeleter;
+        template <typename> friend class ComponentPool;
+
+        // Réinscrit le composant dans les listes de hooks de sa scène selon son état effectif
+        void RefreshHooks();
+        // OnExtract avec le layer du GameObject comme préfixe des clés de tri
+        void Extract(RenderSnapshot& snapshot);
         Component(const Component&)            = delete;
         Component& operator=(const Component&) = delete;
         Component(Component&&)                 = delete;
@@ -29,10 +57,14 @@ namespace Particule::Engine {
         virtual void OnBecameDisabled() {} // appelé juste AVANT OnDisable
     public:
         GameObject& gameObject;
-        Component(GameObject& gameObject) noexcept : m_enabled(true), gameObject(gameObject) {}
-        virtual ~Component() = default;
+        Component(GameObject& gameObject) noexcept : m_enabled(true), gameObject(gameObject) {
+            for (int32_t& slot : m_hookSlot) slot = -1;
+        }
+        virtual ~Component() { if (m_hookOwner) m_hookOwner->Remove(this); }
 
         [[nodiscard]] inline bool enabled() const noexcept { return m_enabled; }
+        [[nodiscard]] inline ComponentTypeId typeId() const noexcept { return m_typeId; }
+        [[nodiscard]] inline bool isPooled() const noexcept { return m_pool != nullptr; }
 
         [[nodiscard]] inline bool isActiveAndEnabled() const
         {
@@ -46,6 +78,7 @@ namespace Particule::Engine {
             const bool wasEffective = isActiveAndEnabled();
             m_enabled = value;
             const bool nowEffective = isActiveAndEnabled();
+            RefreshHooks();
 
             if (wasEffective != nowEffective) {
                 if (nowEffective) {
@@ -61,6 +94,13 @@ namespace Particule::Engine {
         virtual void Awake() {};
         virtual void Start() {};
         virtual void Update() {};
+        // Appelé après Update sur les threads du JobSystem, en parallèle des autres composants :
+        // écrire seulement dans ce composant et le transform de son GameObject,
+        // passer par SceneManager::commands() pour créer, détruire, activer ou reparenter.
+        // Les valeurs monde lues (de tout transform) sont celles du début de la phase, même après une écriture :
+        // préférer localPosition pour lire puis réécrire. Recalculées juste après la phase.
+        // GetComponent y est permis ; StartCoroutine non (le pool de frames de coroutines n'est pas verrouillé)
+        virtual void ParallelUpdate() {};
         virtual void FixedUpdate() {};
         virtual void LateUpdate() {};
 
@@ -68,8 +108,20 @@ namespace Particule::Engine {
         virtual void OnDisable() {};
         virtual void OnDestroy() {};
 
+        // Fin du pas physique (PhysicsWorld2D::Step), sur tous les composants actifs du GameObject :
+        // un de ses Collider2D commence / cesse de toucher un autre collider
+        virtual void OnCollisionEnter(const Collision2D& collision) {(void)collision;};
+        virtual void OnCollisionExit(const Collision2D& collision) {(void)collision;};
+
         virtual void OnRenderObject(Camera* camera) {(void)camera;};
         virtual void OnRenderImage(Camera* camera) {(void)camera;};
+        // Fin de frame : copie dans snapshot ce que le composant dessine (voir SceneManager::SetPipelined).
+        // Lire son propre état, n'écrire que dans snapshot ; en mode pipeline, appelé sur le thread de simulation.
+        // Les commandes prennent le layer du GameObject ; snapshot.SetDepth les ordonne dans ce layer
+        virtual void OnExtract(RenderSnapshot& snapshot) {(void)snapshot;};
+        // Zone monde couverte par ce que dessine le composant : hors de la vue de la caméra,
+        // OnRenderObject et OnExtract ne sont pas appelés. false : pas de bornes, jamais écarté
+        virtual bool GetRenderBounds(Bounds2D& bounds) const {(void)bounds; return false;};
 
         Coroutine* StartCoroutine(Coroutine&& co) {
             return CoroutineManager::instance().start(std::move(co));
@@ -85,35 +137,134 @@ namespace Particule::Engine {
 
     };
 
+    // Hooks redéfinis par T : &T::Update n'a le type void (Component::*)() que si aucune classe entre T et Component ne le redéfinit
+    template <typename T>
+    constexpr uint8_t ComponentHookMask() noexcept
+    {
+        uint8_t mask = 0;
+        if constexpr (!std::is_same_v<decltype(&T::FixedUpdate), void (Component::*)()>) mask |= HookBit(ComponentHook::FixedUpdate);
+        if constexpr (!std::is_same_v<decltype(&T::Update), void (Component::*)()>) mask |= HookBit(ComponentHook::Update);
+        if constexpr (!std::is_same_v<decltype(&T::ParallelUpdate), void (Component::*)()>) mask |= HookBit(ComponentHook::ParallelUpdate);
+        if constexpr (!std::is_same_v<decltype(&T::LateUpdate), void (Component::*)()>) mask |= HookBit(ComponentHook::LateUpdate);
+        if constexpr (!std::is_same_v<decltype(&T::OnRenderObject), void (Component::*)(Camera*)>) mask |= HookBit(ComponentHook::RenderObject);
+        if constexpr (!std::is_same_v<decltype(&T::OnRenderImage), void (Component::*)(Camera*)>) mask |= HookBit(ComponentHook::RenderImage);
+        if constexpr (!std::is_same_v<decltype(&T::OnExtract), void (Component::*)(RenderSnapshot&)>) mask |= HookBit(ComponentHook::Extract);
+        return mask;
+    }
+
+    // Composants d'un GameObject qui sont des T_Component, dans l'ordre d'ajout, sans allocation
+    template <typename T_Component>
+    class ComponentRange
+    {
+        using Base = std::remove_const_t<T_Component>;
+        using Slot = const ComponentPtr*;
+        Slot m_begin;
+        Slot m_end;
+
+    public:
+        class iterator
+        {
+            Slot m_it;
+            Slot m_end;
+            inline void skip() {
+                while (m_it != m_end && !ComponentRegistry::IsA<Base>((*m_it)->typeId(), m_it->get())) ++m_it;
+            }
+        public:
+            iterator(Slot it, Slot end) : m_it(it), m_end(end) { skip(); }
+            inline T_Component* operator*() const noexcept { return static_cast<T_Component*>(m_it->get()); }
+            inline iterator& operator++() { ++m_it; skip(); return *this; }
+            inline bool operator==(const iterator& o) const noexcept { return m_it == o.m_it; }
+            inline bool operator!=(const iterator& o) const noexcept { return m_it != o.m_it; }
+        };
+
+        ComponentRange(Slot begin, Slot end) noexcept : m_begin(begin), m_end(end) {}
+        inline iterator begin() const { return iterator(m_begin, m_end); }
+        inline iterator end() const { return iterator(m_end, m_end); }
+        inline bool empty() const { return begin() == end(); }
+    };
+
     template <typename T_Component, typename... Args>
     T_Component* GameObject::AddComponent(Args&&... args)
     {
         static_assert(std::is_base_of_v<Component, T_Component>,
                     "T_Component must derive from Component");
-        auto up = std::make_unique<T_Component>(*this, std::forward<Args>(args)...);
-        T_Component* raw = up.get();
+        // Type poolé : bloc de la scène, sinon arena de la scène, sinon allocation individuelle
+        ComponentPtr up;
+        if constexpr (PooledComponent<T_Component>)
+        {
+            if (ComponentPools* pools = GetComponentPools(scene))
+                up.reset(pools->Get<T_Component>().Create(*this, std::forward<Args>(args)...));
+        }
+        else if (SceneArena* arena = GetSceneArena(scene))
+        {
+            // Si le constructeur lève, le bloc reste à l'arena jusqu'au déchargement de la scène
+            if (void* mem = arena->Allocate(sizeof(T_Component), alignof(T_Component)))
+            {
+                T_Component* c = ::new (mem) T_Component(*this, std::forward<Args>(args)...);
+                c->m_arena = arena;
+                up.reset(c);
+            }
+        }
+        if (!up)
+            up.reset(new T_Component(*this, std::forward<Args>(args)...));
+        T_Component* raw = static_cast<T_Component*>(up.get());
+        const ComponentTypeId id = ComponentRegistry::Id<T_Component>();
+        raw->m_typeId = id;
+        raw->m_hookMask = ComponentHookMask<T_Component>();
         components.emplace_back(std::move(up));
+        // upper_bound : à type égal, l'ordre d'ajout est conservé
+        auto pos = std::upper_bound(componentIndex.begin(), componentIndex.end(), id,
+            [](ComponentTypeId v, const ComponentEntry& e) { return v < e.type; });
+        componentIndex.insert(pos, ComponentEntry{ id, raw });
+        componentMask |= uint64_t(1) << (id & 63);
+        raw->RefreshHooks(); // ajout à un GameObject déjà actif
         return raw;
     }
 
-    // GetComponent (non-const)
+    // Type exact : masque puis recherche dichotomique, sans RTTI
+    template <typename T_Component>
+    Component* GameObject::FindExactComponent() const noexcept
+    {
+        const ComponentTypeId id = ComponentRegistry::Id<T_Component>();
+        if (!(componentMask & (uint64_t(1) << (id & 63)))) return nullptr;
+        auto it = std::lower_bound(componentIndex.begin(), componentIndex.end(), id,
+            [](const ComponentEntry& e, ComponentTypeId v) { return e.type < v; });
+        return (it != componentIndex.end() && it->type == id) ? it->component : nullptr;
+    }
+
+    // GetComponent : le type exact en priorité, sinon le premier composant dérivé (ordre d'ajout)
     template <typename T_Component>
     [[nodiscard]] T_Component* GameObject::GetComponent()
     {
-        for (auto& up : components)
-            if (auto* p = dynamic_cast<T_Component*>(up.get()))
-                return p;
-        return nullptr;
+        if (Component* c = FindExactComponent<T_Component>())
+            return static_cast<T_Component*>(c);
+        if constexpr (std::is_final_v<T_Component>)
+            return nullptr;
+        else
+        {
+            auto range = Components<T_Component>();
+            auto it = range.begin();
+            return it != range.end() ? *it : nullptr;
+        }
     }
 
     // GetComponent (const)
     template <typename T_Component>
     [[nodiscard]] const T_Component* GameObject::GetComponent() const
     {
-        for (auto const& up : components)
-            if (auto* p = dynamic_cast<const T_Component*>(up.get()))
-                return p;
-        return nullptr;
+        return const_cast<GameObject*>(this)->GetComponent<T_Component>();
+    }
+
+    template <typename T_Component>
+    [[nodiscard]] ComponentRange<T_Component> GameObject::Components() noexcept
+    {
+        return ComponentRange<T_Component>(components.data(), components.data() + components.size());
+    }
+
+    template <typename T_Component>
+    [[nodiscard]] ComponentRange<const T_Component> GameObject::Components() const noexcept
+    {
+        return ComponentRange<const T_Component>(components.data(), components.data() + components.size());
     }
 
     // GetComponents (non-const)
@@ -121,10 +272,8 @@ namespace Particule::Engine {
     [[nodiscard]] std::vector<T_Component*> GameObject::GetComponents()
     {
         std::vector<T_Component*> list;
-        list.reserve(components.size());
-        for (auto& up : components)
-            if (auto* p = dynamic_cast<T_Component*>(up.get()))
-                list.push_back(p);
+        for (T_Component* p : Components<T_Component>())
+            list.push_back(p);
         return list;
     }
 
@@ -133,10 +282,8 @@ namespace Particule::Engine {
     [[nodiscard]] std::vector<const T_Component*> GameObject::GetComponents() const
     {
         std::vector<const T_Component*> list;
-        list.reserve(components.size());
-        for (auto const& up : components)
-            if (auto* p = dynamic_cast<const T_Component*>(up.get()))
-                list.push_back(p);
+        for (const T_Component* p : Components<T_Component>())
+            list.push_back(p);
         return list;
     }
 
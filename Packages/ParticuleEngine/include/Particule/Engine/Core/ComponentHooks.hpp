@@ -0,0 +1,109 @@
+#ifndef PE_CORE_COMPONENT_HOOKS_HPP
+#define PE_CORE_COMPONENT_HOOKS_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <Particule/Core/System/JobSystem.hpp>
+
+namespace Particule::Engine {
+
+    class Component;
+
+    // Méthodes appelées à chaque frame, dispatchées par listes
+    enum class ComponentHook : uint8_t
+    {
+        FixedUpdate,
+        Update,
+        ParallelUpdate,
+        LateUpdate,
+        RenderObject,
+        RenderImage,
+        Extract,
+        Count
+    };
+
+    constexpr std::size_t COMPONENT_HOOK_COUNT = static_cast<std::size_t>(ComponentHook::Count);
+
+    constexpr uint8_t HookBit(ComponentHook hook) noexcept { return static_cast<uint8_t>(1u << static_cast<uint8_t>(hook)); }
+
+    /*
+    Une liste dense par hook et par scène : seuls les composants actifs (GameObject actif dans la hiérarchie,
+    composant activé, initialisé) qui redéfinissent réellement le hook y figurent.
+    Retrait en O(1) par échange avec le dernier ; pendant un dispatch, le retrait laisse un trou
+    compacté à la fin du parcours pour ne sauter aucun composant.
+    */
+    class ComponentHooks
+    {
+    private:
+        struct List
+        {
+            std::vector<Component*> items;
+            int iterating = 0;
+            bool holes = false;
+        };
+        List m_lists[COMPONENT_HOOK_COUNT];
+
+        void Compact(List& list, std::size_t hook) noexcept;
+        void EndDispatch(ComponentHook hook) noexcept;
+
+    public:
+        ComponentHooks() = default;
+        ComponentHooks(const ComponentHooks&) = delete;
+        ComponentHooks& operator=(const ComponentHooks&) = delete;
+        ~ComponentHooks();
+
+        void Add(Component* c);
+        void Remove(Component* c) noexcept;
+
+        [[nodiscard]] inline std::size_t size(ComponentHook hook) const noexcept
+        {
+            return m_lists[static_cast<std::size_t>(hook)].items.size();
+        }
+
+        template <typename Method, typename... Args>
+        void Dispatch(ComponentHook hook, Method method, Args&&... args)
+        {
+            List& list = m_lists[static_cast<std::size_t>(hook)];
+            ++list.iterating;
+            // Taille relue à chaque tour : un composant activé pendant le dispatch est appelé dans la même frame
+            for (std::size_t i = 0; i < list.items.size(); ++i)
+                if (auto* c = list.items[i])
+                    (c->*method)(std::forward<Args>(args)...);
+            EndDispatch(hook);
+        }
+
+        // Comme Dispatch, en sautant les composants pour lesquels keep(c) renvoie false
+        template <typename Keep, typename Method, typename... Args>
+        void DispatchIf(ComponentHook hook, Keep&& keep, Method method, Args&&... args)
+        {
+            List& list = m_lists[static_cast<std::size_t>(hook)];
+            ++list.iterating;
+            for (std::size_t i = 0; i < list.items.size(); ++i)
+                if (auto* c = list.items[i]; c && keep(*c))
+                    (c->*method)(std::forward<Args>(args)...);
+            EndDispatch(hook);
+        }
+
+        // Appel réparti sur les workers du JobSystem par tranches de grain composants ;
+        // la liste ne doit pas changer pendant l'appel (voir CommandBuffer)
+        template <typename Method>
+        void DispatchParallel(ComponentHook hook, Method method, uint32_t grain)
+        {
+            List& list = m_lists[static_cast<std::size_t>(hook)];
+            ++list.iterating;
+            Component* const* items = list.items.data();
+            Particule::Core::JobSystem::ParallelFor(static_cast<uint32_t>(list.items.size()), grain,
+                [items, method](uint32_t begin, uint32_t end) {
+                    for (uint32_t i = begin; i < end; ++i)
+                        if (Component* c = items[i])
+                            (c->*method)();
+                });
+            EndDispatch(hook);
+        }
+    };
+
+}
+
+#endif // PE_CORE_COMPONENT_HOOKS_HPP
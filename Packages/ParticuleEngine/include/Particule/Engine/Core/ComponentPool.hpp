@@ -0,0 +1,144 @@
+#ifndef PE_CORE_COMPONENT_POOL_HPP
+#define PE_CORE_COMPONENT_POOL_HPP
+
+#include <Particule/Engine/Core/ComponentType.hpp>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Particule::Engine {
+
+    class Component;
+    class Scene;
+
+    /*
+    Stockage optionnel des composants par type et par scène, en blocs contigus à adresses stables.
+    Un type l'active en déclarant : static constexpr bool pooled = true;
+    Les composants restent possédés par leur GameObject (même cycle de vie), seule la mémoire change.
+    */
+    template <typename T>
+    concept PooledComponent = requires { requires T::pooled; };
+
+    class ComponentPoolBase
+    {
+    public:
+        virtual ~ComponentPoolBase() = default;
+        // Détruit le composant et libère son emplacement
+        virtual void Destroy(Component* component) noexcept = 0;
+    };
+
+    template <typename T>
+    class ComponentPool final : public ComponentPoolBase
+    {
+    public:
+        static constexpr std::size_t CHUNK = 32; // composants par bloc (un bit de présence chacun)
+
+    private:
+        struct Chunk
+        {
+            alignas(T) unsigned char storage[sizeof(T) * CHUNK];
+            uint32_t live = 0;
+            inline T* at(std::size_t i) noexcept { return std::launder(reinterpret_cast<T*>(storage + i * sizeof(T))); }
+        };
+        std::vector<std::unique_ptr<Chunk>> m_chunks;
+        std::vector<uint32_t> m_free; // emplacements libres : bloc * CHUNK + index
+        std::size_t m_count = 0;
+
+    public:
+        ComponentPool() = default;
+        ComponentPool(const ComponentPool&) = delete;
+        ComponentPool& operator=(const ComponentPool&) = delete;
+
+        template <typename... Args>
+        T* Create(Args&&... args)
+        {
+            if (m_free.empty())
+            {
+                const uint32_t base = static_cast<uint32_t>(m_chunks.size() * CHUNK);
+                m_chunks.push_back(std::make_unique<Chunk>());
+                for (uint32_t i = CHUNK; i-- > 0; )
+                    m_free.push_back(base + i);
+            }
+            const uint32_t slot = m_free.back();
+            Chunk& chunk = *m_chunks[slot / CHUNK];
+            T* t = ::new (static_cast<void*>(chunk.storage + (slot % CHUNK) * sizeof(T))) T(std::forward<Args>(args)...);
+            m_free.pop_back();
+            chunk.live |= uint32_t(1) << (slot % CHUNK);
+            t->m_pool = this; // accès via T : Component est encore incomplet ici
+            t->m_poolSlot = slot;
+            ++m_count;
+            return t;
+        }
+
+        void Destroy(Component* component) noexcept override
+        {
+            T* t = static_cast<T*>(component);
+            const uint32_t slot = t->m_poolSlot;
+            t->~T();
+            m_chunks[slot / CHUNK]->live &= ~(uint32_t(1) << (slot % CHUNK));
+            m_free.push_back(slot);
+            --m_count;
+        }
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_count; }
+
+        // Parcours linéaire bloc par bloc ; un composant détruit pendant le parcours n'est plus visité
+        template <typename F>
+        void ForEach(F&& f)
+        {
+            for (std::size_t c = 0; c < m_chunks.size(); ++c)
+            {
+                Chunk& chunk = *m_chunks[c];
+                for (uint32_t bits = chunk.live; bits; )
+                {
+                    const int i = std::countr_zero(bits);
+                    f(*chunk.at(static_cast<std::size_t>(i)));
+                    bits = i < 31 ? chunk.live & (~uint32_t(0) << (i + 1)) : 0;
+                }
+            }
+        }
+    };
+
+    // Pools d'une scène, indexés par ComponentTypeId
+    class ComponentPools
+    {
+    private:
+        std::vector<std::unique_ptr<ComponentPoolBase>> m_pools;
+
+    public:
+        template <typename T>
+        ComponentPool<T>& Get()
+        {
+            const ComponentTypeId id = ComponentRegistry::Id<T>();
+            if (m_pools.size() <= id) m_pools.resize(id + 1);
+            if (!m_pools[id]) m_pools[id] = std::make_unique<ComponentPool<T>>();
+            return *static_cast<ComponentPool<T>*>(m_pools[id].get());
+        }
+
+        template <typename T>
+        ComponentPool<T>* Find() noexcept
+        {
+            const ComponentTypeId id = ComponentRegistry::Id<T>();
+            return id < m_pools.size() ? static_cast<ComponentPool<T>*>(m_pools[id].get()) : nullptr;
+        }
+    };
+
+    // Pools de la scène (nullptr sans scène), défini dans Scene.cpp
+    ComponentPools* GetComponentPools(Scene* scene) noexcept;
+
+    // Détruit un composant selon son origine (pool ou new)
+    struct ComponentDeleter
+    {
+        void operator()(Component* component) const noexcept;
+    };
+
+    using ComponentPtr = std::unique_ptr<Component, ComponentDeleter>;
+
+}
+
+#endif // PE_CORE_COMPONENT_POOL_HPP
@@ -0,0 +1,69 @@
+#ifndef PE_CORE_COMPONENT_TYPE_HPP
+#define PE_CORE_COMPONENT_TYPE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace Particule::Engine {
+
+    class Component;
+
+    using ComponentTypeId = uint16_t;
+
+    /*
+    Identifiants de types de composants, attribués une fois par type au premier AddComponent / GetComponent.
+    La table d'ascendance (type concret -> est-un type de base ?) est remplie à la première rencontre
+    de chaque paire : un seul dynamic_cast par paire de types pour toute l'exécution, ensuite simple lecture.
+    Appelable depuis ParallelUpdate : compteur atomique, et la table (qui peut grandir) est lue et remplie
+    sous un verrou tournant, pris seulement quand le type demandé n'est pas le type concret.
+    */
+    class ComponentRegistry
+    {
+    private:
+        enum Relation : uint8_t { Unknown = 0, No = 1, Yes = 2 };
+        static std::vector<std::vector<uint8_t>>& relations() noexcept; // [dérivé][base]
+        static ComponentTypeId Next() noexcept;
+        static std::atomic_flag& lock() noexcept;
+
+        struct Guard
+        {
+            Guard() noexcept { while (lock().test_and_set(std::memory_order_acquire)) {} }
+            ~Guard() { lock().clear(std::memory_order_release); }
+        };
+
+    public:
+        template <typename T>
+        static ComponentTypeId Id() noexcept
+        {
+            static const ComponentTypeId id = Next();
+            return id;
+        }
+
+        // Le composant (de type concret derived) est-il un T ?
+        template <typename T>
+        static bool IsA(ComponentTypeId derived, Component* instance)
+        {
+            const ComponentTypeId base = Id<T>();
+            if (derived == base) return true;
+            Guard guard;
+            auto& table = relations();
+            if (table.size() <= derived) table.resize(derived + 1);
+            auto& row = table[derived];
+            if (row.size() <= base) row.resize(base + 1, Unknown);
+            if (row[base] == Unknown)
+                row[base] = dynamic_cast<T*>(instance) ? Yes : No;
+            return row[base] == Yes;
+        }
+    };
+
+    // Entrée de la table triée (type -> composant) d'un GameObject
+    struct ComponentEntry
+    {
+        ComponentTypeId type;
+        Component* component;
+    };
+
+}
+
+#endif // PE_CORE_COMPONENT_TYPE_HPP
@@ -5,42 +5,81 @@
 #include <optional>
 #include <stack>
 #include <ctime>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <Particule/Core/System/Time.hpp>
 
 namespace Particule::Engine {
 
     using Clock = std::chrono::steady_clock;
 
+    // Attente personnalisée : allouée par l'appelant, keepWaiting() interrogé à chaque frame
     struct YieldInstruction {
         virtual bool keepWaiting() = 0;
         virtual ~YieldInstruction() = default;
     };
 
-    struct WaitForSeconds : public YieldInstruction {
-        Particule::Core::Timer timer;
-        WaitForSeconds(float seconds) {
-            timer.start(static_cast<uint32_t>(seconds * 1000000)); // Convert seconds to microseconds
-        }
-        bool keepWaiting() override {
-            return !timer.isFinished();
-        }
+    // Attentes courantes, stockées dans la promesse sans allocation : co_yield WaitForSeconds(0.5f);
+    // (co_yield std::make_unique<WaitForSeconds>(0.5f) reste accepté)
+    struct WaitForSeconds {
+        uint32_t durationUs;
+        explicit WaitForSeconds(float seconds) : durationUs(static_cast<uint32_t>(seconds * 1000000)) {} // Convert seconds to microseconds
     };
 
-    struct WaitForMilliseconds : public YieldInstruction {
-        Particule::Core::Timer timer;
+    struct WaitForMilliseconds {
+        uint32_t durationUs;
+        explicit WaitForMilliseconds(uint32_t milliseconds) : durationUs(milliseconds * 1000) {} // Convert milliseconds to microseconds
+    };
 
-        WaitForMilliseconds(uint32_t milliseconds) {
-            timer.start(milliseconds * 1000); // Convert milliseconds to microseconds
-        }
+    struct WaitForFrames {
+        uint32_t frames;
+        explicit WaitForFrames(uint32_t frames) : frames(frames) {}
+    };
+
+    // Prédicat interrogé à chaque frame, copié dans la promesse : co_yield WaitUntil([&] { return done; });
+    class WaitUntil {
+        static constexpr std::size_t CAPACITY = 4 * sizeof(void*);
+        alignas(void*) unsigned char m_storage[CAPACITY];
+        bool (*m_call)(const void*) = nullptr;
 
-        bool keepWaiting() override {
-            return !timer.isFinished();
+    public:
+        WaitUntil() = default;
+
+        template <typename F>
+            requires (!std::is_same_v<std::decay_t<F>, WaitUntil>)
+        WaitUntil(F&& predicate) {
+            using Fn = std::decay_t<F>;
+            static_assert(sizeof(Fn) <= CAPACITY && alignof(Fn) <= alignof(void*) && std::is_trivially_copyable_v<Fn>,
+                          "WaitUntil: predicate must be small and trivially copyable (capture by reference)");
+            ::new (static_cast<void*>(m_storage)) Fn(std::forward<F>(predicate));
+            m_call = [](const void* p) { return static_cast<bool>((*static_cast<const Fn*>(p))()); };
         }
+
+        inline bool operator()() const { return m_call(m_storage); }
+    };
+
+    // Horloge des coroutines : un horodatage et un numéro de frame, avancés une fois par CoroutineManager::update
+    struct CoroutineClock {
+        static inline uint32_t nowUs = 0;
+        static inline uint32_t frame = 0;
+        // Comparaison tolérante au rebouclage des compteurs 32 bits
+        static inline bool reached(uint32_t now, uint32_t target) noexcept { return static_cast<int32_t>(now - target) >= 0; }
     };
 
+    // Cadres de coroutines : listes libres par classe de taille, jamais rendues au tas
+    struct CoroutineFramePool {
+        static void* Allocate(std::size_t size);
+        static void Deallocate(void* p, std::size_t size) noexcept;
+    };
 
     class CoroutineManager; // Forward declaration
 
+    // Attente en cours d'une coroutine
+    enum class CoroutineWait : uint8_t { None, Time, Frames, Until, Instruction };
+
     class Coroutine {
     public:
         struct promise_type;
@@ -54,18 +93,32 @@ namespace Particule::Engine {
         bool is_done() const;
         void update();
 
-        void stop(); // marquer comme terminé
+        void stop(); // marquer comme terminé (retiré à la frame suivante par le CoroutineManager)
         friend class CoroutineManager;
 
     private:
+        static constexpr uint32_t NO_SLOT = UINT32_MAX;
         handle_type handle = nullptr;
         bool manuallyStopped = false;
+        uint32_t slotIndex = NO_SLOT; // emplacement du CoroutineManager (non transféré par move)
+
+        // Attente de la coroutine la plus interne : Time et Frames donnent une clé de réveil (key)
+        CoroutineWait pendingWait(uint32_t& key) const;
     };
 
     struct Coroutine::promise_type {
+        using Wait = CoroutineWait;
+
+        Wait wait = Wait::None;
+        uint32_t wakeUs = 0;    // Time : horodatage de réveil
+        uint32_t wakeFrame = 0; // Frames : frame de réveil
+        WaitUntil until;
         std::optional<Coroutine> yieldedCoroutine;
         std::unique_ptr<YieldInstruction> yieldInstr;
 
+        static void* operator new(std::size_t size) { return CoroutineFramePool::Allocate(size); }
+        static void operator delete(void* p, std::size_t size) noexcept { CoroutineFramePool::Deallocate(p, size); }
+
         Coroutine get_return_object() {
             return Coroutine{handle_type::from_promise(*this)};
         }
@@ -74,11 +127,33 @@ namespace Particule::Engine {
 
         std::suspend_always final_suspend() noexcept { return {}; }
 
-        std::suspend_always yield_value(std::unique_ptr<YieldInstruction> instr) {
-            yieldInstr = std::move(instr);
+        std::suspend_always yield_value(WaitForSeconds w) { return waitFor(w.durationUs); }
+        std::suspend_always yield_value(WaitForMilliseconds w) { return waitFor(w.durationUs); }
+
+        std::suspend_always yield_value(WaitForFrames w) {
+            wait = Wait::Frames;
+            wakeFrame = CoroutineClock::frame + w.frames;
             return {};
         }
 
+        std::suspend_always yield_value(WaitUntil predicate) {
+            wait = Wait::Until;
+            until = predicate;
+            return {};
+        }
+
+        template <typename T>
+        std::suspend_always yield_value(std::unique_ptr<T> instr) {
+            if constexpr (std::is_same_v<T, WaitForSeconds> || std::is_same_v<T, WaitForMilliseconds>)
+                return waitFor(instr->durationUs);
+            else {
+                static_assert(std::is_base_of_v<YieldInstruction, T>, "co_yield: unsupported instruction");
+                wait = Wait::Instruction;
+                yieldInstr = std::move(instr);
+                return {};
+            }
+        }
+
         std::suspend_always yield_value(Coroutine subCoroutine) {
             yieldedCoroutine = std::move(subCoroutine);
             return {};
@@ -86,6 +161,13 @@ namespace Particule::Engine {
 
         void return_void() {}
         void unhandled_exception() { std::terminate(); }
+
+    private:
+        std::suspend_always waitFor(uint32_t durationUs) {
+            wait = Wait::Time;
+            wakeUs = CoroutineClock::nowUs + durationUs;
+            return {};
+        }
     };
 
     inline Coroutine::Coroutine(handle_type h) : handle(h) {}
@@ -109,8 +191,17 @@ namespace Particule::Engine {
         return manuallyStopped || !handle || handle.done();
     }
 
-    inline void Coroutine::stop() {
-        manuallyStopped = true;
+    inline CoroutineWait Coroutine::pendingWait(uint32_t& key) const {
+        using Wait = CoroutineWait;
+        const Coroutine* co = this;
+        while (!co->is_done()) {
+            const promise_type& promise = co->handle.promise();
+            if (promise.wait == Wait::Time) { key = promise.wakeUs; return Wait::Time; }
+            if (promise.wait == Wait::Frames) { key = promise.wakeFrame; return Wait::Frames; }
+            if (promise.wait != Wait::None || !promise.yieldedCoroutine) break;
+            co = &*promise.yieldedCoroutine;
+        }
+        return Wait::None;
     }
 
     inline void Coroutine::update() {
@@ -118,10 +209,25 @@ namespace Particule::Engine {
 
         auto& promise = handle.promise();
 
-        if (promise.yieldInstr) {
-            if (promise.yieldInstr->keepWaiting()) return;
-            promise.yieldInstr = nullptr;
+        using Wait = promise_type::Wait;
+        switch (promise.wait) {
+            case Wait::None:
+                break;
+            case Wait::Time:
+                if (!CoroutineClock::reached(CoroutineClock::nowUs, promise.wakeUs)) return;
+                break;
+            case Wait::Frames:
+                if (!CoroutineClock::reached(CoroutineClock::frame, promise.wakeFrame)) return;
+                break;
+            case Wait::Until:
+                if (!promise.until()) return;
+                break;
+            case Wait::Instruction:
+                if (promise.yieldInstr->keepWaiting()) return;
+                promise.yieldInstr = nullptr;
+                break;
         }
+        promise.wait = Wait::None;
 
         if (promise.yieldedCoroutine) {
             promise.yieldedCoroutine->update();
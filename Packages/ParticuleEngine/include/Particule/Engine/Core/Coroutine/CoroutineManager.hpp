@@ -2,21 +2,63 @@
 #include <Particule/Engine/Core/Coroutine/Coroutine.hpp>
 #include <vector>
 #include <memory>
+#include <cstdint>
 
 namespace Particule::Engine {
 
+    /*
+    Ordonnanceur : les coroutines qui attendent un temps (WaitForSeconds/Milliseconds) ou un nombre
+    de frames dorment dans un tas-min par clé de réveil et ne sont visitées qu'à échéance ;
+    les autres (WaitUntil, YieldInstruction, premier lancement) sont interrogées à chaque frame.
+    Le coût d'une frame suit le nombre de coroutines réveillées, pas le nombre total.
+    */
     class CoroutineManager {
     public:
         Coroutine* start(Coroutine&& co);
         void stop(Coroutine& coroutine);
         void update();
 
+        [[nodiscard]] inline std::size_t count() const noexcept { return liveCount; }
+        [[nodiscard]] inline std::size_t sleepingCount() const noexcept { return timeHeap.size() + frameHeap.size(); }
+
         static CoroutineManager& instance();
 
     private:
         CoroutineManager();
         ~CoroutineManager() = default;
-        std::vector<std::unique_ptr<Coroutine>> coroutines;
+
+        // Coroutines stockées par valeur dans des blocs (adresses stables pour start/stop),
+        // emplacements libérés réutilisés
+        static constexpr std::size_t CHUNK = 32;
+        struct Slot {
+            Coroutine co{ Coroutine::handle_type{} };
+            uint32_t generation = 0; // invalide les entrées de tas périmées
+            int32_t polledPos = -1;  // position dans polled, -1 si endormie
+        };
+        struct Sleeper {
+            uint32_t key;
+            uint32_t slot;
+            uint32_t generation;
+        };
+
+        std::vector<std::unique_ptr<Slot[]>> chunks;
+        std::vector<uint32_t> freeSlots;
+        std::vector<uint32_t> polled;   // interrogées à chaque frame
+        std::vector<Sleeper> timeHeap;  // clé : CoroutineClock::nowUs de réveil
+        std::vector<Sleeper> frameHeap; // clé : CoroutineClock::frame de réveil
+        std::vector<Sleeper> due;       // réveillées cette frame
+        std::size_t liveCount = 0;
+
+        inline Slot& slot(uint32_t index) noexcept { return chunks[index / CHUNK][index % CHUNK]; }
+        void addPolled(uint32_t index);
+        void removePolled(uint32_t index) noexcept;
+        void popDue(std::vector<Sleeper>& heap, uint32_t now);
+        // Reprend la coroutine puis la range selon sa nouvelle attente (ou la retire si terminée)
+        void run(uint32_t index);
+        void retire(uint32_t index) noexcept;
+        // Remet une coroutine endormie dans la liste interrogée (stop)
+        void wake(uint32_t index);
+        friend class Coroutine;
     };
 
-}
\ No newline at end of file
+}
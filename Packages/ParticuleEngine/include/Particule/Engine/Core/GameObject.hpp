@@ -4,6 +4,9 @@
 #include <Particule/Core/ParticuleCore.hpp>
 #include "Object.hpp"
 #include "Transform.hpp"
+#include "ComponentType.hpp"
+#include "ComponentPool.hpp"
+#include "SceneArena.hpp"
 #include <Particule/Engine/Enum/Layer.hpp>
 #include <Particule/Engine/Enum/Tag.hpp>
 #include <vector>
@@ -15,14 +18,58 @@ namespace Particule::Engine {
 
     class Component;
     class Scene;
+    class Prefab;
+    template <typename T_Component> class ComponentRange;
+    class GameObject;
+
+    // Détruit un GameObject selon son origine (arena de la scène ou new)
+    struct GameObjectDeleter
+    {
+        void operator()(GameObject* go) const noexcept;
+    };
+
+    using GameObjectPtr = std::unique_ptr<GameObject, GameObjectDeleter>;
+
+    // Cycle de vie d'un GameObject dans sa scène
+    enum class GameObjectState : uint8_t
+    {
+        PendingInit,    // en attente de Awake/OnEnable/Start (frame suivante)
+        Alive,
+        PendingDestroy  // retiré à la fin de la frame
+    };
 
     class GameObject : public Object
     {
     private:
         bool m_activeSelf;
+        bool m_activeInHierarchy; // cache : activeSelf et tous les parents actifs
+        GameObjectState m_state = GameObjectState::Alive;
+        int32_t m_sceneIndex = -1; // position dans Scene::gameObjects_
+        int32_t m_initIndex = -1;  // position dans SceneManager::to_initialize_ (PendingInit)
+        const Prefab* m_prefab = nullptr; // prefab d'origine (instance recyclable)
+        bool m_pooled = false;            // rangé inactif dans le pool de son prefab
+        SceneArena* m_arena = nullptr;    // arena de la scène si alloué dedans
+        uint16_t m_renderProxies = 0;     // proxies inscrits qui englobent son rendu (SpatialBody::SetEnclosesRendering)
+        uint32_t m_cullStamp = 0;         // dernier Camera::Cull dont la requête l'a trouvé
         Scene *scene;
-        std::vector<std::unique_ptr<Component>> components;
+        std::vector<ComponentPtr> components;
+        // Index par type : table triée (type -> composant) et masque des types présents (bit = id % 64)
+        std::vector<ComponentEntry> componentIndex;
+        uint64_t componentMask = 0;
         friend class Scene;
+        friend class SceneManager;
+        friend class Component;
+        friend class Transform;
+        friend class SpatialHash;
+        friend class Camera;
+        friend struct GameObjectDeleter;
+
+        template <typename T_Component>
+        Component* FindExactComponent() const noexcept;
+        // Retire et détruit immédiatement le composant (sans callback)
+        void RemoveComponent(Component* component) noexcept;
+        // Recalcule le cache depuis le parent ; ajoute à changed (ordre parent -> enfants) les objets dont l'état change
+        void UpdateActiveInHierarchy(std::vector<GameObject*>& changed);
 
         GameObject() = delete;
         GameObject(const GameObject&) = delete;
@@ -40,16 +87,13 @@ namespace Particule::Engine {
         GameObject(Scene *scene, std::string name);
         ~GameObject() override;
 
-        inline bool activeInHierarchy() const
-        {
-            return this->activeSelf() 
-                && (this->transform.parent() == nullptr 
-                    || this->transform.parent()->gameObject.activeInHierarchy());
-        };
+        inline bool activeInHierarchy() const noexcept { return m_activeInHierarchy; }
         inline bool activeSelf() const noexcept { return m_activeSelf; }
         void SetActive(bool value);
 
         inline Scene *GetScene() const noexcept { return scene; }
+        inline GameObjectState state() const noexcept { return m_state; }
+        inline const Prefab* prefab() const noexcept { return m_prefab; }
 
         template <typename T_Component, typename... Args>
         T_Component* AddComponent(Args&&... args);
@@ -66,6 +110,13 @@ namespace Particule::Engine {
         template <typename T_Component>
         [[nodiscard]] std::vector<const T_Component*> GetComponents() const;
 
+        // Variante sans allocation : for (Collider* c : go.Components<Collider>())
+        template <typename T_Component>
+        [[nodiscard]] ComponentRange<T_Component> Components() noexcept;
+
+        template <typename T_Component>
+        [[nodiscard]] ComponentRange<const T_Component> Components() const noexcept;
+
         template<typename Method, typename... Args>
         void CallComponents(Method method, bool includeInactive, Args&&... args);
 
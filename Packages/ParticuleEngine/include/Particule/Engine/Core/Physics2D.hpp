@@ -0,0 +1,183 @@
+#ifndef PE_CORE_PHYSICS2D_HPP
+#define PE_CORE_PHYSICS2D_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace Particule::Engine {
+
+    using namespace Particule::Core;
+
+    class GameObject;
+    class Rigidbody2D;
+    class Collider2D;
+    class PhysicsWorld2D;
+
+    // Inscription d'un Rigidbody2D ou d'un Collider2D dans un monde ; tenue à jour par le monde
+    // (remise à zéro au retrait, réattribuée quand le GameObject change de scène)
+    struct PhysicsHandle
+    {
+        PhysicsWorld2D* world = nullptr;
+        uint32_t id = std::numeric_limits<uint32_t>::max();
+    };
+
+    // Paramètre de Component::OnCollisionEnter / OnCollisionExit, vu depuis le GameObject qui le reçoit
+    struct Collision2D
+    {
+        Collider2D* collider = nullptr;           // collider de ce GameObject
+        Collider2D* otherCollider = nullptr;
+        Rigidbody2D* otherRigidbody = nullptr;    // nullptr : collider statique
+        Vector2<fixed16_32> normal;               // de collider vers otherCollider (nulle pour Exit)
+        Vector2<fixed16_32> point;                // point de contact monde (nul pour Exit)
+    };
+
+    /*
+    Physique 2D entière d'une scène : corps sans rotation, boîtes alignées sur les axes et cercles, en fixed16_32.
+    Step (après les FixedUpdate, un pas de timeStep par frame) :
+    - intégration des vitesses (gravité, forces) des corps éveillés ;
+    - broadphase sort-and-sweep : liste persistante des colliders triée sur min.x, retriée par insertion
+      (quasi linéaire quand les objets bougent peu d'un pas à l'autre), puis balayage ;
+    - narrowphase boîte/boîte, cercle/cercle, boîte/cercle, avec contacts spéculatifs : les bornes d'un corps
+      sont allongées de son déplacement du pas et une paire encore séparée de moins que ce déplacement donne
+      un contact qui n'autorise que l'approche restante (pas de traversée des objets fins à grande vitesse) ;
+    - îlots (union-find des corps dynamiques en contact) : un îlot dont tous les corps sont au repos depuis
+      sleepFrames pas s'endort ; un corps éveillé en mouvement qui le touche réveille tout l'îlot ;
+    - impulsions séquentielles (rebond, frottement de Coulomb), reprises du pas précédent pour les contacts
+      qui persistent (piles stables en peu d'itérations), intégration des positions, correction
+      de la pénétration, écriture des transforms ;
+    - OnCollisionEnter / OnCollisionExit groupés en fin de pas, dans l'ordre des paires ; un collider retiré
+      (désactivé, détruit ou changé de scène) envoie tout de suite OnCollisionExit aux colliders qu'il touchait.
+    Seuls des entiers sont utilisés et tous les parcours suivent l'ordre d'inscription ou des clés totales :
+    mêmes inscriptions et mêmes entrées donnent le même résultat au bit près sur toutes les cibles.
+    */
+    class PhysicsWorld2D
+    {
+    public:
+        static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+        Vector2<fixed16_32> gravity{ fixed16_32(0), fixed16_32(0) }; // unités par seconde², y vers le bas
+        fixed16_32 timeStep = fixed16_32::constant(1.0L / 60);
+        int velocityIterations = 6;
+        fixed16_32 slop = fixed16_32::constant(0.25L);          // pénétration tolérée, non corrigée ; marge des bornes
+        fixed16_32 correction = fixed16_32::constant(0.4L);     // part de la pénétration corrigée par pas
+        fixed16_32 sleepSpeed = fixed16_32(4);                  // vitesse sous laquelle un corps est au repos
+        uint16_t sleepFrames = 30;
+
+    private:
+        enum class ShapeKind : uint8_t { Box, Circle };
+
+        // Valeurs brutes fixed16_32 : la narrowphase et le solveur calculent sur 64 bits
+        struct Shape
+        {
+            Collider2D* collider = nullptr;
+            Rigidbody2D* body = nullptr;  // nullptr : statique, à la position du transform
+            uint32_t next = NONE;         // collider suivant du même corps
+            ShapeKind kind = ShapeKind::Box;
+            int32_t offsetX = 0, offsetY = 0;
+            int32_t halfX = 0, halfY = 0; // cercle : halfX = halfY = rayon
+            int32_t centerX = 0, centerY = 0;
+            int32_t minX = 0, minY = 0, maxX = 0, maxY = 0;
+            uint32_t layerBit = 0, mask = 0;
+            int32_t friction = 0, bounciness = 0;
+            uint32_t stamp = 0;           // worldStamp du transform (collider statique)
+        };
+
+        // Copie des bornes pour que le balayage reste dans un tableau contigu
+        struct AxisEntry
+        {
+            int32_t minX, maxX, minY, maxY;
+            uint32_t shape;
+        };
+
+        struct Contact
+        {
+            uint32_t a, b;                // a < b
+            Rigidbody2D* bodyA;
+            Rigidbody2D* bodyB;
+            int32_t nx, ny;               // normale unitaire de a vers b
+            int32_t penetration;          // négative : séparation d'un contact spéculatif
+            int32_t px, py;               // point de contact
+            int64_t massNormal;           // 1 / (1/ma + 1/mb)
+            int64_t bias;                 // vitesse normale visée (rebond)
+            int64_t normalImpulse, tangentImpulse;
+            int32_t friction;
+            bool touching;                // en contact ou le sera pendant ce pas
+        };
+
+        // Impulsions cumulées d'un contact au pas précédent : point de départ du solveur (warm starting)
+        struct Cached
+        {
+            uint64_t key;
+            int32_t nx, ny;
+            int64_t normalImpulse, tangentImpulse;
+        };
+
+        struct Event
+        {
+            uint64_t key;
+            Collider2D* a;
+            Collider2D* b;
+            int32_t nx, ny, px, py;
+            bool enter;
+        };
+
+        std::vector<Shape> m_shapes;
+        std::vector<uint32_t> m_freeShapes;
+        std::vector<Rigidbody2D*> m_bodies;       // ordre d'inscription, retrait par échange avec le dernier
+        std::vector<AxisEntry> m_axis;            // trié sur (minX, shape)
+        std::size_t m_unsorted = 0;               // entrées ajoutées en fin de m_axis depuis le dernier pas
+        std::vector<Contact> m_contacts;
+        std::vector<Cached> m_cache;              // trié sur key
+        std::vector<uint64_t> m_links;            // paires d'un corps endormi, non testées ce pas
+        std::vector<uint64_t> m_touching;         // paires en contact au pas précédent, triées
+        std::vector<uint64_t> m_current;
+        std::vector<Event> m_events;
+        std::vector<uint32_t> m_parent;           // union-find des îlots, par corps
+        std::vector<uint8_t> m_islandFlags;
+
+        static inline uint64_t PairKey(uint32_t a, uint32_t b) noexcept { return (uint64_t(a) << 32) | b; }
+        void LoadShape(Shape& s);
+        void UpdateBounds(Shape& s);
+        void Attach(uint32_t shape, Rigidbody2D* body);
+        void Detach(uint32_t shape) noexcept;
+        void SyncBodies();
+        void Broadphase();
+        bool Collide(uint32_t a, uint32_t b, int64_t margin, Contact& c) const;
+        uint32_t Find(uint32_t body) noexcept;
+        void Islands();
+        void Solve();
+        void Integrate();
+        void Correct();
+        void Publish();
+        void Report();
+
+    public:
+        PhysicsWorld2D() = default;
+        PhysicsWorld2D(const PhysicsWorld2D&) = delete;
+        PhysicsWorld2D& operator=(const PhysicsWorld2D&) = delete;
+
+        // Les colliders du GameObject déjà inscrits s'y rattachent
+        void AddBody(Rigidbody2D& body);
+        void RemoveBody(uint32_t id) noexcept;
+        void AddShape(Collider2D& collider);
+        void RemoveShape(uint32_t id) noexcept;
+        // Relit la géométrie et le matériau d'un collider modifié
+        void RefreshShape(uint32_t id);
+        // Passe à dst le corps et les colliders de go (Scene::MoveGameObjectTo)
+        void MoveObject(GameObject& go, PhysicsWorld2D& dst);
+
+        void Step();
+
+        [[nodiscard]] Rigidbody2D* attachedBody(uint32_t shape) const noexcept { return m_shapes[shape].body; }
+        [[nodiscard]] std::size_t bodyCount() const noexcept { return m_bodies.size(); }
+        [[nodiscard]] std::size_t shapeCount() const noexcept { return m_shapes.size() - m_freeShapes.size(); }
+        // Contacts résolus au dernier pas (paires dont au moins un corps est éveillé, spéculatifs compris)
+        [[nodiscard]] std::size_t contactCount() const noexcept { return m_contacts.size(); }
+    };
+
+}
+
+#endif // PE_CORE_PHYSICS2D_HPP
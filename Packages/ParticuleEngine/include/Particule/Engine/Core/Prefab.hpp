@@ -0,0 +1,111 @@
+#ifndef PE_CORE_PREFAB_HPP
+#define PE_CORE_PREFAB_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/Engine/Core/GameObject.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+#include <Particule/Engine/Enum/Layer.hpp>
+#include <Particule/Engine/Enum/Tag.hpp>
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstddef>
+
+namespace Particule::Engine {
+
+    using namespace Particule::Core;
+
+    /*
+    Description réutilisable d'un GameObject : nom, layer, tag, transform initial et composants.
+    Instancié par Scene::Instantiate, qui recycle les instances rendues par Scene::Despawn
+    (désactivées puis réactivées : OnDisable / OnEnable) au lieu de les détruire.
+    Le Prefab doit survivre aux scènes qui l'utilisent (typiquement une variable statique).
+
+    Création et réutilisation :
+    - AddComponent et Configure construisent la structure de l'instance (composants, enfants) :
+      exécutés une seule fois, à la création ; les arguments de constructeur ne sont pas réappliqués ;
+    - layer, tag, transform et les étapes Reset sont appliqués à la création puis à chaque réutilisation,
+      avant OnEnable : tout état qu'une partie peut modifier (vie, vitesse...) doit être remis là.
+
+        static Prefab bullet = Prefab("Bullet")
+            .AddComponent<Bullet>(speed)
+            .Reset([](GameObject& go) { go.GetComponent<Bullet>()->traveled = 0; });
+        bullet.poolCapacity = 64;
+        scene.Prewarm(bullet, 32);   // dans le loader de la scène
+        GameObject* b = scene.Instantiate(bullet, position);
+        scene.Despawn(b);
+    */
+    class Prefab
+    {
+    private:
+        std::vector<std::function<void(GameObject&)>> m_builders;
+        std::vector<std::function<void(GameObject&)>> m_resets;
+
+    public:
+        std::string name;
+        Layer layer = Layer::LAYER_Default;
+        Tag tag = Tag::TAG_Untagged;
+        Vector3<fixed12_32> position{ fixed12_32(0), fixed12_32(0), fixed12_32(0) };
+        Vector3<fixed12_32> rotation{ fixed12_32(0), fixed12_32(0), fixed12_32(0) };
+        Vector3<fixed12_32> scale{ fixed12_32(1), fixed12_32(1), fixed12_32(1) };
+        // Instances inactives gardées par scène ; au-delà, Despawn détruit l'objet
+        std::size_t poolCapacity = 16;
+
+        explicit Prefab(std::string name) : name(std::move(name)) {}
+
+        // Composant ajouté à chaque nouvelle instance, construit avec une copie de args
+        template <typename T_Component, typename... Args>
+        Prefab& AddComponent(Args... args)
+        {
+            m_builders.emplace_back([=](GameObject& go) { go.AddComponent<T_Component>(args...); });
+            return *this;
+        }
+
+        // Étape libre exécutée à la création de chaque instance (structure : composants, enfants...)
+        Prefab& Configure(std::function<void(GameObject&)> builder)
+        {
+            m_builders.push_back(std::move(builder));
+            return *this;
+        }
+
+        // Étape exécutée à la création et à chaque réutilisation (valeurs initiales) ; ne doit rien ajouter
+        Prefab& Reset(std::function<void(GameObject&)> step)
+        {
+            m_resets.push_back(std::move(step));
+            return *this;
+        }
+
+        // Remplit une nouvelle instance
+        void Build(GameObject& go) const
+        {
+            ApplyDefaults(go);
+            for (const auto& builder : m_builders)
+                builder(go);
+            for (const auto& step : m_resets)
+                step(go);
+        }
+
+        // Remet une instance recyclée dans l'état initial : layer, tag, transform puis étapes Reset
+        void Respawn(GameObject& go) const
+        {
+            ApplyDefaults(go);
+            for (const auto& step : m_resets)
+                step(go);
+        }
+
+    private:
+        void ApplyDefaults(GameObject& go) const
+        {
+            go.layer = layer;
+            go.tag = tag;
+            go.transform.Edit([&](Transform::Locals& l) {
+                l.position = position;
+                l.rotation = rotation;
+                l.scale = scale;
+            });
+        }
+    };
+
+}
+
+#endif // PE_CORE_PREFAB_HPP
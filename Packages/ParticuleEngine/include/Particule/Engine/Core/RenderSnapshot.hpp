@@ -0,0 +1,132 @@
+#ifndef PE_CORE_RENDER_SNAPSHOT_HPP
+#define PE_CORE_RENDER_SNAPSHOT_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/Engine/Core/Skybox.hpp>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <unordered_map>
+#include <cstdint>
+
+namespace Particule::Engine {
+
+    using namespace Particule::Core;
+
+    /*
+    Liste de dessin d'une frame, remplie pendant l'extraction (Component::OnExtract) puis rejouée par
+    SceneManager::Draw sur le thread principal. Chaque commande copie ce qu'il faut pour dessiner
+    (texture, rectangles, couleur, texte) : en mode pipeline, la simulation de la frame suivante
+    peut modifier ou détruire les composants pendant que cette liste est dessinée.
+
+    Chaque commande porte une clé de tri sur 64 bits, des bits forts aux bits faibles :
+        layer (8) | profondeur (16) | ordre d'ajout (20) | type (3) | teinte (1) | texture ou police (8) | couleur (8)
+    Sort la trie par radix (stable) : les layers se superposent toujours dans le même ordre, puis les
+    profondeurs ; à profondeur égale, l'ordre d'ajout décide, comme en dessin immédiat.
+    Les commandes ajoutées après SetDepth(depth, true) ont toutes l'ordre 0 : dans cette profondeur,
+    tous composants confondus, celles qui partagent texture et couleur se suivent (moins de changements
+    d'état du backend), sous les commandes ordinaires de même profondeur. À réserver à ce qui ne se
+    recouvre pas ou dont l'ordre est indifférent (tuiles, particules).
+    */
+    class RenderSnapshot
+    {
+    public:
+        // Dans un groupe (SetDepth(depth, true)), les types sont dessinés dans cet ordre
+        enum class Kind : uint8_t
+        {
+            Texture,
+            RectFilled,
+            RectOutline,
+            Line,
+            Pixel,
+            Text,
+            Custom
+        };
+
+        struct Command
+        {
+            Kind kind;
+            bool tinted = false;  // Texture : couleur appliquée
+            uint64_t key = 0;     // clé de tri (voir plus haut)
+            int x = 0, y = 0;
+            int w = 0, h = 0;     // Line : point d'arrivée ; Text : taille de police dans w
+            Rect source{};        // Texture : sous-rectangle
+            Color color;
+            union
+            {
+                Texture* texture;
+                Font* font;
+            };
+            uint32_t offset = 0;  // Text : début dans le tampon de texte ; Custom : index du callback
+            uint32_t length = 0;  // Text : nombre de caractères
+
+            explicit Command(Kind kind) : kind(kind), texture(nullptr) {}
+        };
+
+    private:
+        struct SortEntry
+        {
+            uint64_t key;
+            uint32_t index;
+        };
+
+        std::vector<Command> m_commands;
+        std::vector<SortEntry> m_order;              // commandes triées (Sort), sinon vide
+        std::vector<SortEntry> m_sortBuffer;
+        std::unordered_map<const void*, uint32_t> m_stateIds; // texture ou police -> identifiant de la frame
+        uint64_t m_prefix = uint64_t(0x8000) << 40;  // layer et profondeur des prochaines commandes
+        uint32_t m_sequence = 0;                     // ordre d'ajout de la dernière commande (saturé)
+        bool m_batch = false;                        // profondeur courante groupée par état
+        std::string m_text;                          // textes de la frame, concaténés
+        std::vector<std::function<void()>> m_custom;
+        Skybox m_sky;
+        bool m_hasSky = false;
+
+        uint64_t StateKey(Kind kind, bool tinted, const void* state, const Color& color);
+
+    public:
+        RenderSnapshot() = default;
+        RenderSnapshot(const RenderSnapshot&) = delete;
+        RenderSnapshot& operator=(const RenderSnapshot&) = delete;
+
+        // Vide la liste en gardant la mémoire
+        void Clear() noexcept;
+
+        void SetSky(const Skybox& sky) { m_sky = sky; m_hasSky = true; }
+
+        // Layer des commandes suivantes, profondeur remise à 0 non groupée (appelé avant OnExtract de chaque composant)
+        inline void Begin(uint8_t layer) noexcept { m_prefix = uint64_t(layer) << 56 | uint64_t(0x8000) << 40; m_batch = false; }
+        // Profondeur des commandes suivantes dans le layer : plus grande = dessinée par-dessus.
+        // batch : regroupées par état plutôt que dans l'ordre d'ajout (voir plus haut)
+        inline void SetDepth(int16_t depth, bool batch = false) noexcept
+        {
+            m_prefix = (m_prefix & ~(uint64_t(0xFFFF) << 40)) | uint64_t(static_cast<uint16_t>(depth + 0x8000)) << 40;
+            m_batch = batch;
+        }
+
+        void DrawSprite(Sprite& sprite, int x, int y);
+        void DrawSprite(Sprite& sprite, int x, int y, int w, int h);
+        void DrawSpriteColor(Sprite& sprite, int x, int y, const Color& color);
+        void DrawTexture(Texture* texture, int x, int y, int w, int h, Rect source);
+        void DrawText(Font* font, std::string_view text, int x, int y, const Color& color, int size);
+        void DrawRectFilled(int x, int y, int w, int h, const Color& color);
+        void DrawRectOutline(int x, int y, int w, int h, const Color& color);
+        void DrawLine(int x1, int y1, int x2, int y2, const Color& color);
+        void DrawPixel(int x, int y, const Color& color);
+        // Le callback est appelé pendant Draw : il ne doit utiliser que des valeurs capturées par copie
+        void DrawCustom(std::function<void()> draw);
+
+        // Trie les commandes par clé (radix LSD, 8 bits par passe, passes constantes sautées)
+        void Sort();
+
+        // Thread principal, fenêtre liée : fond puis commandes, dans l'ordre de Sort s'il a été appelé
+        void Execute();
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_commands.size(); }
+        [[nodiscard]] inline const std::vector<Command>& commands() const noexcept { return m_commands; }
+    };
+
+}
+
+#endif // PE_CORE_RENDER_SNAPSHOT_HPP
@@ -0,0 +1,67 @@
+#ifndef PE_CORE_SCENE_ARENA_HPP
+#define PE_CORE_SCENE_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Particule::Engine {
+
+    class Scene;
+
+    /*
+    Allocateur optionnel d'une scène : GameObjects et composants (hors pools) sont placés dans de grands blocs.
+    Un bloc libéré est recyclé par classe de taille (jusqu'à MAX_RECYCLED octets) ; le reste n'est rendu
+    qu'à la destruction de la scène, en une fois (pas de fragmentation du tas à long terme).
+    Désactivé tant que Scene::UseArena n'a pas été appelé (Allocate renvoie nullptr).
+    */
+    class SceneArena
+    {
+    public:
+        static constexpr std::size_t DEFAULT_CHUNK = 16 * 1024;
+        static constexpr std::size_t GRAIN = alignof(std::max_align_t); // alignement et taille de l'en-tête
+        static constexpr std::size_t MAX_RECYCLED = 1024;
+
+    private:
+        struct Chunk
+        {
+            Chunk* next;
+            std::size_t size;
+        };
+        static constexpr std::size_t CLASSES = MAX_RECYCLED / GRAIN;
+
+        Chunk* m_chunks = nullptr;
+        unsigned char* m_cursor = nullptr;
+        unsigned char* m_end = nullptr;
+        std::size_t m_chunkSize = 0;
+        std::size_t m_used = 0;     // octets des blocs vivants (en-têtes compris)
+        std::size_t m_reserved = 0; // octets demandés au tas
+        void* m_free[CLASSES] = {}; // listes de blocs libérés, par multiple de GRAIN
+
+        unsigned char* Grow(std::size_t bytes);
+
+    public:
+        SceneArena() = default;
+        SceneArena(const SceneArena&) = delete;
+        SceneArena& operator=(const SceneArena&) = delete;
+        ~SceneArena() { Release(); }
+
+        // chunkSize == 0 : désactivé
+        inline void Enable(std::size_t chunkSize = DEFAULT_CHUNK) noexcept { m_chunkSize = chunkSize; }
+        [[nodiscard]] inline bool enabled() const noexcept { return m_chunkSize != 0; }
+
+        // nullptr si désactivé ou alignement supérieur à GRAIN (l'appelant retombe sur new)
+        void* Allocate(std::size_t size, std::size_t align);
+        void Deallocate(void* p) noexcept;
+        // Rend tous les blocs au tas ; les objets doivent déjà être détruits
+        void Release() noexcept;
+
+        [[nodiscard]] inline std::size_t bytesUsed() const noexcept { return m_used; }
+        [[nodiscard]] inline std::size_t bytesReserved() const noexcept { return m_reserved; }
+    };
+
+    // Arena active de la scène (nullptr sans scène ou arena désactivée), défini dans Scene.cpp
+    SceneArena* GetSceneArena(Scene* scene) noexcept;
+
+}
+
+#endif // PE_CORE_SCENE_ARENA_HPP
@@ -3,6 +3,8 @@
 
 namespace Particule::Engine {
 
+    using namespace Particule::Core;
+
     struct Skybox
     {
         Particule::Core::Color top;
@@ -31,6 +33,32 @@ namespace Particule::Engine {
             rgbStep[1] = (fixed12_32(bottom.G()) - rgb_start[1]) / heightInt;
             rgbStep[2] = (fixed12_32(bottom.B()) - rgb_start[2]) / heightInt;
         }
+
+        // Fond uni ou dégradé vertical dans la fenêtre courante
+        inline void Draw() noexcept
+        {
+            Particule::Core::Window* window = Particule::Core::Window::GetCurrentWindow();
+            if (top.A() == 0 && bottom.A() == 0)
+                return;
+            if (top == bottom)
+                window->Clear(top);
+            else
+            {
+                int heightInt = window->Height();
+                if (height != heightInt)
+                    CalculateGradient(heightInt);
+
+                fixed12_32 rgb[3] = {rgb_start[0], rgb_start[1], rgb_start[2]};
+                for (int y = 0; y < heightInt; y++)
+                {
+                    Particule::Core::Color color(static_cast<int>(rgb[0]), static_cast<int>(rgb[1]), static_cast<int>(rgb[2]), 255);
+                    Particule::Core::DrawHLine(y, color);
+                    rgb[0] += rgbStep[0];
+                    rgb[1] += rgbStep[1];
+                    rgb[2] += rgbStep[2];
+                }
+            }
+        }
     };
 
 }
\ No newline at end of file
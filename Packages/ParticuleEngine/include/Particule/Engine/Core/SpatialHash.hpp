@@ -0,0 +1,126 @@
+#ifndef PE_CORE_SPATIAL_HASH_HPP
+#define PE_CORE_SPATIAL_HASH_HPP
+
+#include <Particule/Core/ParticuleCore.hpp>
+#include <Particule/Engine/Core/Bounds2D.hpp>
+#include <Particule/Engine/Enum/Layer.hpp>
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace Particule::Engine {
+
+    using namespace Particule::Core;
+
+    class Component;
+    class GameObject;
+    class SpatialHash;
+
+    // Inscription d'un composant dans une grille ; tenue à jour par la grille (remise à zéro par Remove,
+    // réattribuée quand le GameObject change de scène). Doit rester à la même adresse tant qu'elle est inscrite
+    struct SpatialProxy
+    {
+        SpatialHash* grid = nullptr;
+        uint32_t id = std::numeric_limits<uint32_t>::max();
+    };
+
+    // Résultat de Raycast et de Nearest
+    struct SpatialHit
+    {
+        Component* component = nullptr;
+        fixed12_32 distance;          // depuis l'origine du rayon ou le point de la requête
+        Vector2<fixed12_32> point;    // Raycast : point d'entrée dans la boîte ; Nearest : point de la boîte le plus proche
+    };
+
+    /*
+    Grille uniforme hachée de boîtes monde (une par proxy, possédé par un composant), une par scène.
+    Les cellules font 2^cellShift unités de côté ; chaque cellule couverte par une boîte référence
+    son proxy dans le seau (cell x, cell y) % bucketCount.
+    Update (fin de frame, après les transforms) ne recalcule que les proxies dont le transform a bougé
+    (Transform::worldStamp) et ne les déplace de seau que si leurs cellules changent ; un proxy
+    ajouté pour un GameObject isStatic est placé une fois et n'est plus vérifié (Refresh pour forcer).
+    Les requêtes ne modifient rien et n'allouent pas : résultats écrits dans out, au plus out.size().
+    Elles voient les positions de la dernière mise à jour et peuvent être appelées depuis ParallelUpdate.
+    */
+    class SpatialHash
+    {
+    public:
+        static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+        // Tous les layers sauf LAYER_IgnoreRaycast
+        static constexpr uint32_t DEFAULT_MASK = ~LayerBit(Layer::LAYER_IgnoreRaycast);
+
+    private:
+        struct Proxy
+        {
+            Component* owner = nullptr;
+            SpatialProxy* handle = nullptr;
+            Bounds2D local;                // relative à la position monde, mise à l'échelle du transform
+            Bounds2D world;
+            int32_t cx0 = 0, cy0 = 0, cx1 = -1, cy1 = -1; // cellules couvertes (bornes incluses)
+            uint32_t stamp = 0;            // worldStamp du transform lors du dernier calcul
+            int32_t dynamicIndex = -1;     // position dans m_dynamic, -1 si statique
+            bool rendering = false;        // la boîte englobe le rendu du GameObject (GameObject::m_renderProxies)
+        };
+
+        std::vector<Proxy> m_proxies;
+        std::vector<uint32_t> m_free;
+        std::vector<uint32_t> m_dynamic;                // proxies vérifiés par Update
+        std::vector<std::vector<uint32_t>> m_buckets;
+        std::vector<uint32_t> m_scratch;                // seaux d'un proxy pendant Link
+        int m_cellShift = 6;
+        // Cellules occupées depuis la dernière Configure : borne les parcours de Raycast et Nearest
+        int32_t m_minX = 0, m_minY = 0, m_maxX = -1, m_maxY = -1;
+
+        [[nodiscard]] inline int32_t Cell(fixed12_32 v) const noexcept { return v.raw() >> (12 + m_cellShift); }
+        [[nodiscard]] inline std::size_t Bucket(int32_t cx, int32_t cy) const noexcept
+        {
+            const uint32_t h = static_cast<uint32_t>(cx) * 73856093u ^ static_cast<uint32_t>(cy) * 19349663u;
+            return h & (m_buckets.size() - 1);
+        }
+        void ComputeWorld(Proxy& p) const;
+        // Inscrit / retire le proxy des seaux de ses cellules (une fois par seau)
+        void Link(uint32_t id);
+        void Unlink(uint32_t id) noexcept;
+        void Move(uint32_t id);
+        template <typename F>
+        void ForEachInCell(int32_t cx, int32_t cy, uint32_t layerMask, F&& f) const;
+
+    public:
+        SpatialHash() { Configure(); }
+        SpatialHash(const SpatialHash&) = delete;
+        SpatialHash& operator=(const SpatialHash&) = delete;
+
+        // Cellules de 2^cellShift unités, bucketCount arrondi à une puissance de 2 ; les proxies sont réinsérés
+        void Configure(int cellShift = 6, std::size_t bucketCount = 1024);
+
+        // local : boîte relative à la position monde du GameObject de owner ; rendering : elle englobe
+        // tout le rendu de ce GameObject, Camera::Cull peut écarter ses composants hors de la requête
+        void Add(SpatialProxy& proxy, Component& owner, const Bounds2D& local, bool rendering = false);
+        void Remove(uint32_t id) noexcept;
+        void SetBounds(uint32_t id, const Bounds2D& local);
+        // Recalcule tout de suite un proxy (statique déplacé, ou requête dans la même frame)
+        void Refresh(uint32_t id);
+        // Fin de frame : proxies dynamiques dont le transform a changé
+        void Update();
+        // Passe à dst les proxies des composants de go (Scene::MoveGameObjectTo)
+        void MoveProxies(GameObject& go, SpatialHash& dst);
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_proxies.size() - m_free.size(); }
+        [[nodiscard]] const Bounds2D& bounds(uint32_t id) const noexcept { return m_proxies[id].world; }
+
+        // Composants dont la boîte recouvre box (bords inclus)
+        std::size_t OverlapBox(const Bounds2D& box, std::span<Component*> out, uint32_t layerMask = DEFAULT_MASK) const;
+        std::size_t OverlapCircle(const Vector2<fixed12_32>& center, fixed12_32 radius, std::span<Component*> out, uint32_t layerMask = DEFAULT_MASK) const;
+        // Première boîte traversée (parcours DDA des cellules) ; LAYER_IgnoreRaycast n'est jamais touché
+        bool Raycast(const Vector2<fixed12_32>& origin, const Vector2<fixed12_32>& direction, SpatialHit& hit,
+                     fixed12_32 maxDistance = fixed12_32(std::numeric_limits<int32_t>::max(), true), uint32_t layerMask = DEFAULT_MASK) const;
+        // Les out.size() boîtes les plus proches de point, triées par distance
+        std::size_t Nearest(const Vector2<fixed12_32>& point, std::span<SpatialHit> out,
+                            fixed12_32 maxDistance = fixed12_32(std::numeric_limits<int32_t>::max(), true), uint32_t layerMask = DEFAULT_MASK) const;
+    };
+
+}
+
+#endif // PE_CORE_SPATIAL_HASH_HPP
@@ -5,6 +5,7 @@
 #include <vector>
 #include <algorithm>
 #include <Particule/Engine/Core/Types/MethodPropertyVec3.hpp>
+#include <Particule/Engine/Core/TransformHierarchy.hpp>
 
 
 namespace Particule::Engine {
@@ -26,17 +27,36 @@ namespace Particule::Engine {
         mutable Vector3<fixed12_32> m_worldPosition{};
         mutable Vector3<fixed12_32> m_worldRotation{};
         mutable Vector3<fixed12_32> m_worldScale{ fixed12_32(1), fixed12_32(1), fixed12_32(1) };
-        mutable bool m_worldDirty = true;
+        mutable bool m_worldDirty = true;          // cache périmé : locals ou un ancêtre modifiés depuis le dernier calcul
+        mutable uint32_t m_worldStamp = 0;         // incrémenté à chaque recalcul monde
+        mutable uint32_t m_parentStamp = 0;        // m_worldStamp du parent lors de notre dernier calcul
 
+        // Hiérarchie à plat de la scène (nullptr hors scène)
+        TransformHierarchy* m_hierarchy = nullptr;
+        int32_t m_hierarchyIndex = -1;
+        friend class TransformHierarchy;
+
+        // Propagé aux descendants (arrêt sur ceux déjà marqués) : un cache propre est valide sans remonter les parents.
+        // Phase parallèle : les descendants appartiennent à d'autres jobs, la passe suivante les rattrape
         inline void markWorldDirty() noexcept {
             if (m_worldDirty) return;
             m_worldDirty = true;
+            if (m_hierarchy) m_hierarchy->MarkWorldDirty();
+            if (TransformHierarchy::frozen()) return;
             for (auto* c : m_children) c->markWorldDirty();
         }
 
-        inline void ensureWorldUpToDate() const noexcept {
-            if (!m_worldDirty) return;
-            if (m_parent) m_parent->ensureWorldUpToDate();
+        inline void markStructureDirty() noexcept {
+            if (m_hierarchy) m_hierarchy->MarkStructureDirty();
+        }
+
+        // Met à jour l'état actif mis en cache du GameObject et de ses descendants (GameObject.cpp)
+        void onParentChanged() noexcept;
+
+        // Recalcule le monde si nécessaire, le parent étant supposé à jour
+        inline void refreshWorld() const noexcept {
+            const uint32_t parentStamp = m_parent ? m_parent->m_worldStamp : 0;
+            if (!m_worldDirty && parentStamp == m_parentStamp) return;
 
             if (!m_parent) {
                 m_worldPosition = m_localPosition;
@@ -47,9 +67,18 @@ namespace Particule::Engine {
                 m_worldRotation = m_parent->m_worldRotation + m_localRotation;
                 m_worldScale    = m_parent->m_worldScale *  m_localScale; // hadamard
             }
+            m_parentStamp = parentStamp;
+            ++m_worldStamp;
             m_worldDirty = false;
         }
 
+        // Phase parallèle : cache tel quel, calculé juste avant la phase
+        inline void ensureWorldUpToDate() const noexcept {
+            if (TransformHierarchy::frozen() || !m_worldDirty) return;
+            if (m_parent) m_parent->ensureWorldUpToDate();
+            refreshWorld();
+        }
+
         // ——— setters/ getters MONDE (utilisés par properties world) ———
         inline void setWorldPosition(const Vector3<fixed12_32>& w) noexcept {
             if (m_parent) { m_parent->ensureWorldUpToDate(); m_localPosition = w - m_parent->m_worldPosition; }
@@ -115,6 +144,7 @@ namespace Particule::Engine {
         }
 
         ~Transform() {
+            if (m_hierarchy) m_hierarchy->Remove(this);
             if (m_parent) {
                 auto& sib = m_parent->m_children;
                 sib.erase(std::remove(sib.begin(), sib.end(), this), sib.end());
@@ -123,6 +153,9 @@ namespace Particule::Engine {
             for (auto* child : m_children) child->SetParent(nullptr);
         }
 
+        // Change à chaque recalcul des valeurs monde : permet de repérer un objet déplacé sans comparer ses valeurs
+        [[nodiscard]] inline uint32_t worldStamp() const noexcept { ensureWorldUpToDate(); return m_worldStamp; }
+
         // -------- Parenting --------
         void SetParent(Transform* parent, bool keepWorld = true) noexcept {
             if (parent == m_parent) return;
@@ -135,11 +168,59 @@ namespace Particule::Engine {
             Vector3<fixed12_32> wP{}, wR{}, wS{};
             if (keepWorld) { ensureWorldUpToDate(); wP=m_worldPosition; wR=m_worldRotation; wS=m_worldScale; }
 
+            markStructureDirty();
             m_parent = parent;
-            if (m_parent) m_parent->m_children.push_back(this);
+            if (m_parent) {
+                m_parent->m_children.push_back(this);
+                m_parent->markStructureDirty();
+            }
 
             if (keepWorld) { setWorldPosition(wP); setWorldRotation(wR); setWorldScale(wS); }
             else           { markWorldDirty(); }
+            onParentChanged();
+        }
+
+        // -------- Édition groupée --------
+        // Plusieurs écritures locales, un seul marquage :
+        // transform.Edit([](Transform::Locals& l) { l.position.x += speed; l.rotation.y = angle; });
+        struct Locals {
+            Vector3<fixed12_32>& position;
+            Vector3<fixed12_32>& rotation;
+            Vector3<fixed12_32>& scale;
+        };
+
+        template <class F>
+        inline void Edit(F&& edit) {
+            Locals locals{ m_localPosition, m_localRotation, m_localScale };
+            edit(locals);
+            markWorldDirty();
+        }
+
+        inline void SetLocalPositionAndRotation(const Vector3<fixed12_32>& p, const Vector3<fixed12_32>& r) noexcept {
+            m_localPosition = p; m_localRotation = r; markWorldDirty();
+        }
+
+        inline void Translate(const Vector3<fixed12_32>& delta) noexcept { m_localPosition += delta; markWorldDirty(); }
+        inline void Rotate(const Vector3<fixed12_32>& euler) noexcept { m_localRotation += euler; markWorldDirty(); }
+
+        // -------- Matrices --------
+        inline Quat<fixed12_32> worldRotationQuat() const noexcept { return Quat<fixed12_32>::fromEuler(getWorldRotation()); }
+
+        inline Mat4<fixed12_32> localToWorldMatrix() const noexcept {
+            ensureWorldUpToDate();
+            return Mat4<fixed12_32>::trs(m_worldPosition, Quat<fixed12_32>::fromEuler(m_worldRotation), m_worldScale);
+        }
+
+        // Inverse de localToWorldMatrix, échelle comprise
+        inline Mat4<fixed12_32> worldToLocalMatrix() const noexcept {
+            return localToWorldMatrix().inverseAffine();
+        }
+
+        // Repère vue d'une caméra : inverse de la seule position / rotation monde (l'échelle est ignorée)
+        inline Mat4<fixed12_32> worldToViewMatrix() const noexcept {
+            ensureWorldUpToDate();
+            return Mat4<fixed12_32>::trs(m_worldPosition, Quat<fixed12_32>::fromEuler(m_worldRotation),
+                                         Vector3<fixed12_32>(fixed12_32(1), fixed12_32(1), fixed12_32(1))).inverseAffine();
         }
 
         inline Transform* parent() const noexcept { return m_parent; }
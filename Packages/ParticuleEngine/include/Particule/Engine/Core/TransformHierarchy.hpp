@@ -0,0 +1,59 @@
+#ifndef PE_CORE_TRANSFORM_HIERARCHY_HPP
+#define PE_CORE_TRANSFORM_HIERARCHY_HPP
+
+#include <vector>
+#include <cstdint>
+#include <atomic>
+
+namespace Particule::Engine {
+
+    class Transform;
+
+    /*
+    Transforms d'une scène rangés à plat en ordre profondeur (parent avant enfants).
+    Une écriture marque le transform et ses descendants (même dans une autre hiérarchie) ; un getter monde
+    ne remonte les parents que pour une entrée marquée. Une seule passe linéaire par frame (UpdateWorld)
+    recalcule les entrées marquées, et ne parcourt rien si aucune entrée de la hiérarchie ne l'est.
+    L'ordre est reconstruit à la passe suivante après un ajout, un retrait ou un SetParent.
+
+    Phase parallèle (Freeze, par SceneManager autour de ParallelUpdate, après une passe sur chaque scène) :
+    aucun cache monde n'est écrit. Les getters monde lisent le cache tel quel, une écriture ne marque
+    que son propre transform ; la passe qui suit la phase recalcule aussi les entrées dont le parent a changé.
+    */
+    class TransformHierarchy
+    {
+    private:
+        std::vector<Transform*> m_order;
+        std::vector<Transform*> m_stack; // pile de parcours de Rebuild, conservée entre deux reconstructions
+        bool m_structureDirty = false;
+        std::atomic<bool> m_worldDirty{ false }; // au moins une entrée marquée ; écrit aussi depuis ParallelUpdate
+        static inline bool s_frozen = false;
+
+        void Rebuild();
+
+    public:
+        TransformHierarchy() = default;
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+        ~TransformHierarchy();
+
+        void Add(Transform* t);
+        void Remove(Transform* t) noexcept;
+
+        inline void MarkStructureDirty() noexcept { m_structureDirty = true; MarkWorldDirty(); }
+        inline void MarkWorldDirty() noexcept { m_worldDirty.store(true, std::memory_order_relaxed); }
+        [[nodiscard]] inline bool worldDirty() const noexcept { return m_worldDirty.load(std::memory_order_relaxed); }
+
+        // Thread principal, hors de la phase : les jobs de la phase voient la valeur par le JobSystem
+        static inline void Freeze(bool value) noexcept { s_frozen = value; }
+        [[nodiscard]] static inline bool frozen() noexcept { return s_frozen; }
+
+        // Passe linéaire : parents d'abord, seules les entrées marquées sont recalculées
+        void UpdateWorld();
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_order.size(); }
+    };
+
+}
+
+#endif // PE_CORE_TRANSFORM_HIERARCHY_HPP
@@ -1,6 +1,8 @@
 #ifndef PE_ENUM_LAYER_HPP
 #define PE_ENUM_LAYER_HPP
 
+#include <cstdint>
+
 namespace Particule::Engine {
 
     typedef enum Layer
@@ -13,6 +15,9 @@ namespace Particule::Engine {
         LAYER_PostProcessing = 8
     } Layer;
 
+    // Bit du layer dans un masque de layers (Camera::cullingMask, requêtes de SpatialHash)
+    constexpr uint32_t LayerBit(Layer layer) noexcept { return uint32_t(1) << (static_cast<uint32_t>(layer) & 31); }
+
 }
 
 #endif // PE_ENUM_LAYER_HPP
\ No newline at end of file
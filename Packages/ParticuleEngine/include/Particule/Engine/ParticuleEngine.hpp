@@ -4,10 +4,24 @@
 #include <Particule/Engine/Scene/SceneManager.hpp>
 #include <Particule/Engine/Core/GameObject.hpp>
 #include <Particule/Engine/Core/Component.hpp>
+#include <Particule/Engine/Core/ComponentHooks.hpp>
+#include <Particule/Engine/Core/ComponentPool.hpp>
+#include <Particule/Engine/Core/CommandBuffer.hpp>
+#include <Particule/Engine/Core/RenderSnapshot.hpp>
+#include <Particule/Engine/Core/Bounds2D.hpp>
+#include <Particule/Engine/Core/SpatialHash.hpp>
+#include <Particule/Engine/Core/Physics2D.hpp>
+#include <Particule/Engine/Core/Prefab.hpp>
+#include <Particule/Engine/Core/SceneArena.hpp>
+#include <Particule/Engine/Core/ComponentType.hpp>
 #include <Particule/Engine/Core/Skybox.hpp>
 #include <Particule/Engine/Core/Transform.hpp>
+#include <Particule/Engine/Core/TransformHierarchy.hpp>
 #include <Particule/Engine/Core/Coroutine/CoroutineManager.hpp>
 #include <Particule/Engine/Core/Coroutine/Coroutine.hpp>
 #include <Particule/Engine/Components/Camera.hpp>
+#include <Particule/Engine/Components/SpatialBody.hpp>
+#include <Particule/Engine/Components/Rigidbody2D.hpp>
+#include <Particule/Engine/Components/Collider2D.hpp>
 
 #endif // PARTICLE_ENGINE_HPP
\ No newline at end of file
@@ -5,10 +5,14 @@
 #include <Particule/Engine/Core/Component.hpp>
 #include <Particule/Engine/Core/Skybox.hpp>
 #include <Particule/Engine/Core/GameObject.hpp>
+#include <Particule/Engine/Core/Prefab.hpp>
+#include <Particule/Engine/Core/SpatialHash.hpp>
+#include <Particule/Engine/Core/Physics2D.hpp>
 #include <vector>
 #include <string>
 #include <memory>
 #include <unordered_set>
+#include <unordered_map>
 #include <algorithm>
 #include <string_view>
 
@@ -18,10 +22,26 @@ namespace Particule::Engine {
     class Scene
     {
     private:
+        // Optional allocator for GameObjects and components; declared first so it is released last, in one step
+        SceneArena arena_;
+        // Chunked storage of pooled component types; declared before the GameObjects so it outlives them
+        ComponentPools pools_;
+        // Flat depth-first transform order; declared first so it outlives the GameObjects
+        TransformHierarchy transforms_;
+        // Grid of the components' world boxes; declared before the GameObjects so they can unregister on destruction
+        SpatialHash spatial_;
+        // Rigidbody2D and Collider2D of the scene, stepped after FixedUpdate; outlives the GameObjects too
+        PhysicsWorld2D physics_;
+        // Dense per-hook lists of active components overriding FixedUpdate, Update, LateUpdate, OnRender*
+        ComponentHooks hooks_;
         // Ownership: Scene exclusively owns its GameObjects
-        std::vector<std::unique_ptr<GameObject>> gameObjects_;
+        std::vector<GameObjectPtr> gameObjects_;
         // Non-owning list scheduled for removal at EndMainLoop
         std::vector<GameObject*> toRemove_;
+        // Components passed to Component::Destroy, removed at EndMainLoop before the GameObjects
+        std::vector<Component*> componentsToRemove_;
+        // Inactive prefab instances waiting for reuse, one free list per prefab
+        std::unordered_map<const Prefab*, std::vector<GameObject*>> prefabPools_;
 
         // Deleted copy/move to avoid accidental duplication of ownership
         Scene(const Scene&) = delete;
@@ -29,20 +49,47 @@ namespace Particule::Engine {
         Scene(Scene&&) = delete;
         Scene& operator=(Scene&&) = delete;
 
-        // Helpers
-        auto find_uptr_(GameObject* ptr) noexcept {
-            return std::find_if(gameObjects_.begin(), gameObjects_.end(),
-                [&](const std::unique_ptr<GameObject>& up){ return up.get() == ptr; });
-        }
+        // Helpers: slot lookup through GameObject::m_sceneIndex
+        bool Owns_(const GameObject* go) const noexcept;
+        // Removes go from gameObjects_ without deleting it (caller takes ownership)
+        void Detach_(GameObject* go) noexcept;
+        GameObject* Spawn_(const Prefab& prefab, const Vector3<fixed12_32>* position);
+        GameObject* NewInstance_(const Prefab& prefab);
+        GameObject& Adopt_(GameObjectPtr go);
+        // MoveGameObjectTo checks and transfer for a single object (descendants are handled by the caller)
+        bool CanMove_(const GameObject* go) const noexcept;
+        void MoveOne_(Scene& dst, GameObject* go) noexcept;
+        // Deactivate prewarmed instances once they went through Awake/OnEnable/Start
+        void ParkPooled_(GameObject* go);
+        void ParkAllPooled_();
 
         // Called once per frame by SceneManager
         void EndMainLoop();
-        void ToInitialize(GameObject* go) noexcept;
-        bool IsNotInitialized(GameObject* go) const noexcept;
+        void ToInitialize(GameObject* go);
+        inline bool IsNotInitialized(const GameObject* go) const noexcept { return go->m_state == GameObjectState::PendingInit; }
 
         bool isLoaded;
         friend class SceneManager;
+        friend ComponentPools* GetComponentPools(Scene* scene) noexcept;
+        friend SceneArena* GetSceneArena(Scene* scene) noexcept;
     public:
+        // Sync hook list membership with the component's effective state (initialized, active and enabled)
+        void RefreshHooks(Component* component);
+        void RefreshHooks(GameObject* go);
+        void RefreshAllHooks();
+
+        template<typename Method, typename... Args>
+        void DispatchHook(ComponentHook hook, Method method, Args&&... args)
+        {
+            hooks_.Dispatch(hook, method, std::forward<Args>(args)...);
+        }
+
+        template<typename Keep, typename Method, typename... Args>
+        void DispatchHookIf(ComponentHook hook, Keep&& keep, Method method, Args&&... args)
+        {
+            hooks_.DispatchIf(hook, keep, method, std::forward<Args>(args)...);
+        }
+
         std::string name;
         bool enabled;
         Skybox skybox;
@@ -52,19 +99,38 @@ namespace Particule::Engine {
 
         void DrawSky() noexcept;
 
+        // Allocate the GameObjects and components created from now on in a scene arena
+        // (call it first in the scene loader); memory is returned in one step when the scene is destroyed
+        inline void UseArena(size_t chunkSize = SceneArena::DEFAULT_CHUNK) noexcept { arena_.Enable(chunkSize); }
+        const SceneArena& arena() const noexcept { return arena_; }
+
         // --- Add / Remove ---
         // Take ownership from unique_ptr
         GameObject& AddGameObject(std::unique_ptr<GameObject> go);
         // Take ownership from raw ptr (for legacy code: new GameObject(scene, ...))
         GameObject& AddGameObject(GameObject* go_raw);
 
-        // Schedule removal at end of frame (safe)
+        // Schedule removal at end of frame (safe); slots are reused by swap-and-pop, so object order is not stable
         void RemoveGameObject(GameObject* go) noexcept;
 
+        // Schedule component removal at end of frame (OnDisable/OnDestroy, then freed); it leaves the hook lists now
+        void RemoveComponent(Component* component);
+
+        // --- Prefabs ---
+        // Reuse a pooled instance (Prefab::Respawn, then SetActive(true) => OnEnable) or build a new one
+        GameObject* Instantiate(const Prefab& prefab);
+        GameObject* Instantiate(const Prefab& prefab, const Vector3<fixed12_32>& position);
+        // Deactivate (OnDisable) and keep for reuse; destroyed instead if not from a prefab or the pool is full
+        void Despawn(GameObject* go);
+        // Build count instances ahead of time (typically from the scene loader), up to prefab.poolCapacity
+        void Prewarm(const Prefab& prefab, size_t count);
+        size_t PooledCount(const Prefab& prefab) const noexcept;
+
         // Find by name (non-owning pointer)
         GameObject* FindGameObject(std::string_view name) const noexcept;
 
-        // Transfer ownership of a GameObject to another scene (keeps the same pointer value for external refs)
+        // Transfer ownership of a GameObject and its descendants to another scene (keeps the same pointer values)
+        // Fails, moving nothing, if one of them or their components live in this scene's pools or arena
         bool MoveGameObjectTo(Scene& dst, GameObject* go) noexcept;
 
         // Iterate components of all objects
@@ -81,17 +147,57 @@ namespace Particule::Engine {
             }
         }
 
+        // Recompute world transforms of modified entries (one linear pass, parents first)
+        inline void UpdateTransforms() { transforms_.UpdateWorld(); }
+
+        // Overlap, raycast and nearest queries over the registered boxes (see SpatialBody)
+        SpatialHash& spatial() noexcept { return spatial_; }
+        const SpatialHash& spatial() const noexcept { return spatial_; }
+
+        // 2D physics settings (gravity, timeStep, ...) and registered bodies
+        PhysicsWorld2D& physics() noexcept { return physics_; }
+        const PhysicsWorld2D& physics() const noexcept { return physics_; }
+
+        // Every pooled T of this scene (enabled or not), walked chunk by chunk without virtual dispatch
+        template<class T, class Fn>
+        void ForEach(Fn&& fn)
+        {
+            static_assert(PooledComponent<T>, "ForEach<T>: T must declare static constexpr bool pooled = true");
+            if (ComponentPool<T>* pool = pools_.Find<T>())
+                pool->ForEach([&](T& c) {
+                    if (!static_cast<Component&>(c).m_destroyed) fn(c);
+                });
+        }
+
+        // Pooled T joined with the other components of its GameObject: fn(T&, Others&...) when all are present
+        template<class T, class... Others, class Fn>
+        void View(Fn&& fn)
+        {
+            ForEach<T>([&](T& c) {
+                auto call = [&](Others*... others) {
+                    if ((... && (others != nullptr))) fn(c, *others...);
+                };
+                call(c.gameObject.template GetComponent<Others>()...);
+            });
+        }
+
         // Iteration utility (read-only)
-        const std::vector<std::unique_ptr<GameObject>>& objects() const noexcept { return gameObjects_; }
+        const std::vector<GameObjectPtr>& objects() const noexcept { return gameObjects_; }
 
         template<class TGO = GameObject, class... Args>
         TGO* EmplaceGameObject(Args&&... args)
         {
-            auto ptr = std::make_unique<TGO>(this, std::forward<Args>(args)...);
-            TGO* raw = ptr.get();
-            AddGameObject(std::move(ptr)); // adoption ownership et association à la scène
+            TGO* raw = nullptr;
+            if (void* mem = arena_.Allocate(sizeof(TGO), alignof(TGO))) {
+                raw = ::new (mem) TGO(this, std::forward<Args>(args)...);
+                raw->m_arena = &arena_;
+            }
+            else
+                raw = new TGO(this, std::forward<Args>(args)...);
+            GameObjectPtr ptr(raw);
             if (isLoaded)
-                ToInitialize(raw);
+                ToInitialize(raw); // avant l'adoption : pas de hooks avant Awake/Start
+            Adopt_(std::move(ptr)); // adoption ownership et association à la scène
             return raw;
         }
         
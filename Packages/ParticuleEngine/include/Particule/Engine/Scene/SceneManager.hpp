@@ -2,6 +2,8 @@
 #define PE_SCENE_MANAGER_HPP
 #include <Particule/Core/ParticuleCore.hpp>
 #include <Particule/Engine/Scene/Scene.hpp>
+#include <Particule/Engine/Core/CommandBuffer.hpp>
+#include <Particule/Engine/Core/RenderSnapshot.hpp>
 #include <vector>
 #include <unordered_set>
 #include <string>
@@ -27,13 +29,44 @@ namespace Particule::Engine {
         std::vector<std::unique_ptr<Scene>> loadedScenes;   // ownership here
         std::unordered_set<int> to_load;
         std::unordered_set<Scene*> to_unload;               // non-owning markers
-        std::unordered_set<GameObject*> to_initialize_;
+        std::vector<GameObject*> to_initialize_;            // creation order; nullptr once removed
         bool loading;
+        // Structural changes requested during the parallel phase, applied right after it
+        CommandBuffer commands_;
+        bool parallelUpdate_;
+
+        // Pipelined mode: frame N+1 is simulated on a JobSystem worker while Draw replays the snapshot of frame N
+        RenderSnapshot snapshots_[2];
+        uint8_t front_;
+        bool pipelined_;
+        bool simulating_;
+        Particule::Core::JobCounter simulation_;
+
+        // Run ParallelUpdate across the JobSystem workers, then apply the deferred commands
+        void ParallelUpdate_();
+        // Scene unload/load and their Awake/OnEnable/Start; always on the main thread (assets, SDL resources)
+        void LoadPending_();
+        // Awake/OnEnable/Start of the objects created since the last frame, in creation order
+        void InitializePending_();
+        // One frame of game logic: update hooks, coroutines, end-of-frame removals
+        void Simulate_();
+        // A scene has components drawn through OnRenderObject/OnRenderImage, which pipelined mode never calls
+        bool HasImmediateRendering_() const noexcept;
+        // Sky of the active scene and OnExtract of every enabled scene
+        void Extract_(RenderSnapshot& snapshot);
+        // OnExtract of the components Camera::main can see (all of them without a camera), then sort.
+        // culled: Camera::main->Cull() already ran this frame, its view is reused
+        void ExtractVisible_(RenderSnapshot& snapshot, bool culled);
+        void WaitSimulation_();
+        static void SimulateJob_(void* data, uint32_t begin, uint32_t end);
 
         friend class Scene;
     public:
         static SceneManager* sceneManager;
 
+        // Components per ParallelUpdate job
+        uint32_t parallelGrain = 64;
+
         SceneManager();
         ~SceneManager() noexcept;
 
@@ -52,6 +85,15 @@ namespace Particule::Engine {
         Scene* GetScene(const std::string& name) const noexcept;
         Scene* activeScene() const noexcept;
 
+        // f(scene) for every enabled scene
+        template<typename F>
+        void ForEachScene(F&& f)
+        {
+            for (auto& up : loadedScenes)
+                if (up->enabled)
+                    f(*up);
+        }
+
         template<typename Method, typename... Args>
         void CallAllComponents(Method method, bool includeInactive, Args&&... args)
         {
@@ -62,6 +104,49 @@ namespace Particule::Engine {
             }
         }
 
+        // Call a per-frame hook on the active components of every enabled scene that override it
+        template<typename Method, typename... Args>
+        void DispatchHook(ComponentHook hook, Method method, Args&&... args)
+        {
+            for (auto& up : loadedScenes) {
+                Scene* scene = up.get();
+                if (scene->enabled)
+                    scene->DispatchHook(hook, method, args...);
+            }
+        }
+
+        // Same, skipping the components for which keep(component) returns false
+        template<typename Keep, typename Method, typename... Args>
+        void DispatchHookIf(ComponentHook hook, Keep&& keep, Method method, Args&&... args)
+        {
+            for (auto& up : loadedScenes) {
+                Scene* scene = up.get();
+                if (scene->enabled)
+                    scene->DispatchHookIf(hook, keep, method, args...);
+            }
+        }
+
+        CommandBuffer& commands() noexcept { return commands_; }
+        // True while ParallelUpdate runs: Component::Destroy goes through commands()
+        bool inParallelUpdate() const noexcept { return parallelUpdate_; }
+
+        /*
+        Pipelined mode (needs at least one JobSystem worker, ignored otherwise, e.g. on Casio):
+        MainLoop starts simulating the frame on a worker and returns; Draw replays the snapshot
+        extracted at the end of the previous frame, then waits for the simulation. Phases:
+        - main thread, in MainLoop: scene loading (loader, Awake/OnEnable/Start of loaded scenes, assets),
+          then Awake/OnEnable/Start of the objects created since the last frame;
+        - simulation thread: FixedUpdate, physics step, Update, ParallelUpdate, coroutines,
+          LateUpdate, removals, then OnExtract. No drawing, no texture/font creation or release there;
+        - main thread, in Draw: the snapshot only. OnRenderObject/OnRenderImage are not called.
+        The window is drawn one frame behind the simulation.
+        Only for scenes drawn through OnExtract: SetPipelined(true) is refused while a component
+        overrides OnRenderObject or OnRenderImage (Particule3D renderers, for instance), and MainLoop
+        goes back to the normal mode as soon as one appears; pipelined() tells which mode runs.
+        */
+        void SetPipelined(bool value);
+        bool pipelined() const noexcept { return pipelined_; }
+
         void MainLoop();
         void Draw();
     };
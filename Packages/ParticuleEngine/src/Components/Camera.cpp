@@ -1,9 +1,11 @@
 #include <Particule/Engine/Components/Camera.hpp>
 #include <Particule/Engine/Scene/SceneManager.hpp>
+#include <Particule/Engine/Scene/Scene.hpp>
 
 namespace Particule::Engine {
 
     Camera *Camera::main = nullptr;
+    uint32_t Camera::s_stamp = 0;
 
     Camera::Camera(GameObject& gameObject): Component(gameObject)
     {
@@ -17,12 +19,84 @@ namespace Particule::Engine {
             Camera::main = nullptr;
     }
 
+    void Camera::FitWindow()
+    {
+        if (!fitWindow) return;
+        if (Window* window = App::GetMainWindow())
+            viewport = Rect{ 0, 0, window->Width(), window->Height() };
+    }
+
+    Bounds2D Camera::ViewRect() const
+    {
+        const Vector3<fixed12_32> p = gameObject.transform.position;
+        const fixed12_32 scale = zoom > 0 ? zoom : fixed12_32(1);
+        const Vector2<fixed12_32> half{ fixed12_32(viewport.w) / (scale * 2), fixed12_32(viewport.h) / (scale * 2) };
+        return Bounds2D::FromCenter({ p.x, p.y }, half);
+    }
+
+    Vector2<int> Camera::WorldToScreen(const Vector2<fixed12_32>& world) const
+    {
+        const Vector3<fixed12_32> p = gameObject.transform.position;
+        const fixed12_32 scale = zoom > 0 ? zoom : fixed12_32(1);
+        return { viewport.x + viewport.w / 2 + static_cast<int>((world.x - p.x) * scale),
+                 viewport.y + viewport.h / 2 + static_cast<int>((world.y - p.y) * scale) };
+    }
+
+    Vector2<fixed12_32> Camera::ScreenToWorld(int x, int y) const
+    {
+        const Vector3<fixed12_32> p = gameObject.transform.position;
+        const fixed12_32 scale = zoom > 0 ? zoom : fixed12_32(1);
+        return { p.x + fixed12_32(x - viewport.x - viewport.w / 2) / scale,
+                 p.y + fixed12_32(y - viewport.y - viewport.h / 2) / scale };
+    }
+
+    Bounds2D Camera::Cull()
+    {
+        const Bounds2D view = ViewRect();
+        m_stamp = 0;
+        m_culled = view;
+        if (viewport.w <= 0 || viewport.h <= 0)
+            return view;
+        if (++s_stamp == 0) ++s_stamp; // 0 : jamais marqué
+        m_stamp = s_stamp;
+        SceneManager::sceneManager->ForEachScene([this, &view](Scene& scene) {
+            const SpatialHash& grid = scene.spatial();
+            if (grid.size() == 0) return;
+            if (m_found.size() < grid.size()) m_found.resize(grid.size());
+            const std::size_t count = grid.OverlapBox(view, m_found, cullingMask);
+            for (std::size_t i = 0; i < count; ++i)
+                m_found[i]->gameObject.m_cullStamp = m_stamp;
+        });
+        return view;
+    }
+
+    bool Camera::IsVisible(const Component& component, const Bounds2D& view) const
+    {
+        const GameObject& go = component.gameObject;
+        if (!(cullingMask & LayerBit(go.layer)))
+            return false;
+        if (viewport.w <= 0 || viewport.h <= 0)
+            return true;
+        Bounds2D bounds;
+        if (!component.GetRenderBounds(bounds))
+            return true; // pas de bornes : jamais écarté
+        // Phase large : un SpatialBody qui englobe le rendu et que la requête n'a pas trouvé suffit à écarter
+        if (go.m_renderProxies && go.m_cullStamp != m_stamp && m_stamp == s_stamp
+            && view.min == m_culled.min && view.max == m_culled.max)
+            return false;
+        return bounds.Overlaps(view);
+    }
+
     void Camera::Render()
     {
         SceneManager* manager = SceneManager::sceneManager;
+        FitWindow();
+        const Bounds2D view = Cull();
         manager->activeScene()->DrawSky();
-        manager->CallAllComponents(&Component::OnRenderObject, false, this);
-        manager->CallAllComponents(&Component::OnRenderImage, false, this);
+        manager->DispatchHookIf(ComponentHook::RenderObject,
+            [this, &view](const Component& c) { return IsVisible(c, view); },
+            &Component::OnRenderObject, this);
+        manager->DispatchHook(ComponentHook::RenderImage, &Component::OnRenderImage, this);
     }
 
-}
\ No newline at end of file
+}
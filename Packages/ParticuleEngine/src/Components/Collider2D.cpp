@@ -0,0 +1,86 @@
+#include <Particule/Engine/Components/Collider2D.hpp>
+#include <Particule/Engine/Scene/Scene.hpp>
+
+namespace Particule::Engine {
+
+    Collider2D::Collider2D(GameObject& gameObject, ColliderShape2D shape, const Vector2<fixed16_32>& offset)
+        : Component(gameObject), m_shape(shape), m_offset(offset)
+    {
+    }
+
+    Collider2D::~Collider2D()
+    {
+        Unregister();
+    }
+
+    void Collider2D::Unregister() noexcept
+    {
+        if (m_handle.world)
+            m_handle.world->RemoveShape(m_handle.id);
+    }
+
+    void Collider2D::Refresh()
+    {
+        if (m_handle.world)
+            m_handle.world->RefreshShape(m_handle.id);
+    }
+
+    void Collider2D::OnEnable()
+    {
+        Unregister();
+        if (Scene* scene = gameObject.GetScene())
+            scene->physics().AddShape(*this);
+    }
+
+    void Collider2D::OnDisable()
+    {
+        Unregister();
+    }
+
+    Rigidbody2D* Collider2D::attachedRigidbody() const noexcept
+    {
+        return m_handle.world ? m_handle.world->attachedBody(m_handle.id) : nullptr;
+    }
+
+    void Collider2D::SetOffset(const Vector2<fixed16_32>& offset)
+    {
+        m_offset = offset;
+        Refresh();
+    }
+
+    void Collider2D::SetMaterial(fixed16_32 friction, fixed16_32 bounciness)
+    {
+        m_friction = friction;
+        m_bounciness = bounciness;
+        Refresh();
+    }
+
+    void Collider2D::SetCollisionMask(uint32_t mask)
+    {
+        m_collisionMask = mask;
+        Refresh();
+    }
+
+    BoxCollider2D::BoxCollider2D(GameObject& gameObject, const Vector2<fixed16_32>& size, const Vector2<fixed16_32>& offset)
+        : Collider2D(gameObject, ColliderShape2D::Box, offset), m_size(size)
+    {
+    }
+
+    void BoxCollider2D::SetSize(const Vector2<fixed16_32>& size)
+    {
+        m_size = size;
+        Refresh();
+    }
+
+    CircleCollider2D::CircleCollider2D(GameObject& gameObject, fixed16_32 radius, const Vector2<fixed16_32>& offset)
+        : Collider2D(gameObject, ColliderShape2D::Circle, offset), m_radius(radius)
+    {
+    }
+
+    void CircleCollider2D::SetRadius(fixed16_32 radius)
+    {
+        m_radius = radius;
+        Refresh();
+    }
+
+}
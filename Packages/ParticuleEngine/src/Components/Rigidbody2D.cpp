@@ -0,0 +1,83 @@
+#include <Particule/Engine/Components/Rigidbody2D.hpp>
+#include <Particule/Engine/Scene/Scene.hpp>
+
+namespace Particule::Engine {
+
+    Rigidbody2D::Rigidbody2D(GameObject& gameObject, fixed16_32 mass): Component(gameObject)
+    {
+        SetMass(mass);
+    }
+
+    Rigidbody2D::~Rigidbody2D()
+    {
+        Unregister();
+    }
+
+    void Rigidbody2D::Unregister() noexcept
+    {
+        if (m_handle.world)
+            m_handle.world->RemoveBody(m_handle.id);
+    }
+
+    void Rigidbody2D::OnEnable()
+    {
+        Unregister();
+        if (Scene* scene = gameObject.GetScene())
+            scene->physics().AddBody(*this);
+    }
+
+    void Rigidbody2D::OnDisable()
+    {
+        Unregister();
+    }
+
+    void Rigidbody2D::SetMass(fixed16_32 mass)
+    {
+        // Sous 1/256, l'inverse ne tient plus dans un fixed16_32
+        m_mass = mass < fixed16_32::constant(1.0L / 256) ? fixed16_32::constant(1.0L / 256) : mass;
+        m_invMass = fixed16_32(1) / m_mass;
+    }
+
+    void Rigidbody2D::SetVelocity(const Vector2<fixed16_32>& velocity)
+    {
+        m_velocity = velocity;
+        WakeUp();
+    }
+
+    void Rigidbody2D::AddForce(const Vector2<fixed16_32>& force)
+    {
+        m_force += force;
+        WakeUp();
+    }
+
+    void Rigidbody2D::AddImpulse(const Vector2<fixed16_32>& impulse)
+    {
+        if (!isDynamic()) return;
+        m_velocity += Vector2<fixed16_32>(impulse.x * m_invMass, impulse.y * m_invMass);
+        WakeUp();
+    }
+
+    void Rigidbody2D::MovePosition(const Vector2<fixed16_32>& position)
+    {
+        m_position = position;
+        Vector3<fixed12_32> p = gameObject.transform.position;
+        m_written = Vector2<fixed12_32>(fixed12_32(position.x), fixed12_32(position.y));
+        p.x = m_written.x;
+        p.y = m_written.y;
+        gameObject.transform.position = p;
+        WakeUp();
+    }
+
+    void Rigidbody2D::WakeUp() noexcept
+    {
+        m_awake = true;
+        m_restFrames = 0;
+    }
+
+    void Rigidbody2D::Sleep() noexcept
+    {
+        m_awake = false;
+        m_velocity = Vector2<fixed16_32>(fixed16_32(0), fixed16_32(0));
+    }
+
+}
@@ -0,0 +1,56 @@
+#include <Particule/Engine/Components/SpatialBody.hpp>
+#include <Particule/Engine/Scene/Scene.hpp>
+
+namespace Particule::Engine {
+
+    SpatialBody::SpatialBody(GameObject& gameObject, const Bounds2D& bounds): Component(gameObject), m_bounds(bounds)
+    {
+    }
+
+    SpatialBody::~SpatialBody()
+    {
+        Unregister();
+    }
+
+    void SpatialBody::Unregister() noexcept
+    {
+        if (m_proxy.grid)
+            m_proxy.grid->Remove(m_proxy.id);
+    }
+
+    void SpatialBody::OnEnable()
+    {
+        Unregister();
+        if (Scene* scene = gameObject.GetScene())
+            scene->spatial().Add(m_proxy, *this, m_bounds, m_enclosesRendering);
+    }
+
+    void SpatialBody::OnDisable()
+    {
+        Unregister();
+    }
+
+    void SpatialBody::SetBounds(const Bounds2D& bounds)
+    {
+        m_bounds = bounds;
+        if (m_proxy.grid)
+            m_proxy.grid->SetBounds(m_proxy.id, bounds);
+    }
+
+    void SpatialBody::SetEnclosesRendering(bool encloses)
+    {
+        if (encloses == m_enclosesRendering) return;
+        m_enclosesRendering = encloses;
+        if (SpatialHash* grid = m_proxy.grid)
+        {
+            grid->Remove(m_proxy.id);
+            grid->Add(m_proxy, *this, m_bounds, encloses);
+        }
+    }
+
+    Bounds2D SpatialBody::worldBounds() const
+    {
+        return m_proxy.grid ? m_proxy.grid->bounds(m_proxy.id) : Bounds2D{};
+    }
+
+}
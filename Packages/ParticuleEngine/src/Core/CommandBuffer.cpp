@@ -0,0 +1,73 @@
+#include <Particule/Engine/Core/CommandBuffer.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+#include <Particule/Engine/Core/Prefab.hpp>
+#include <Particule/Engine/Scene/Scene.hpp>
+
+namespace Particule::Engine {
+
+    void CommandBuffer::Begin()
+    {
+        const uint32_t threads = JobSystem::ThreadCount();
+        if (m_lanes.size() < threads)
+            m_lanes.resize(threads);
+    }
+
+    void CommandBuffer::Apply()
+    {
+        for (auto& lane : m_lanes)
+        {
+            // Taille relue : une commande peut en ajouter d'autres (thread principal, file 0)
+            for (std::size_t i = 0; i < lane.size(); ++i)
+            {
+                std::function<void()> command = std::move(lane[i]);
+                command();
+            }
+            lane.clear();
+        }
+    }
+
+    void CommandBuffer::Push(std::function<void()> command)
+    {
+        m_lanes[JobSystem::ThreadIndex()].push_back(std::move(command));
+    }
+
+    void CommandBuffer::Destroy(Component* component)
+    {
+        Push([component] { Component::Destroy(component); });
+    }
+
+    void CommandBuffer::Destroy(GameObject* go)
+    {
+        Push([go] { Component::Destroy(go); });
+    }
+
+    void CommandBuffer::SetActive(GameObject* go, bool value)
+    {
+        Push([go, value] { go->SetActive(value); });
+    }
+
+    void CommandBuffer::SetEnabled(Component* component, bool value)
+    {
+        Push([component, value] { component->SetEnabled(value); });
+    }
+
+    void CommandBuffer::SetParent(Transform* transform, Transform* parent, bool keepWorld)
+    {
+        Push([transform, parent, keepWorld] { transform->SetParent(parent, keepWorld); });
+    }
+
+    void CommandBuffer::Instantiate(Scene* scene, const Prefab* prefab, const Vector3<fixed12_32>& position,
+                                    std::function<void(GameObject&)> then)
+    {
+        Push([scene, prefab, position, then = std::move(then)] {
+            GameObject* go = scene->Instantiate(*prefab, position);
+            if (go && then) then(*go);
+        });
+    }
+
+    void CommandBuffer::Despawn(GameObject* go)
+    {
+        Push([go] { if (Scene* scene = go->GetScene()) scene->Despawn(go); });
+    }
+
+}
@@ -1,20 +1,69 @@
 #include <Particule/Engine/Core/GameObject.hpp>
 #include <Particule/Engine/Core/Component.hpp>
 #include <Particule/Engine/Core/Transform.hpp>
+#include <Particule/Engine/Core/RenderSnapshot.hpp>
 #include <Particule/Engine/Scene/Scene.hpp>
 #include <Particule/Engine/Scene/SceneManager.hpp>
 namespace Particule::Engine {
 
     using namespace Particule::Core;
 
-    void Component::Destroy(Component* component) {
-        if (component)
+    std::vector<std::vector<uint8_t>>& ComponentRegistry::relations() noexcept {
+        static std::vector<std::vector<uint8_t>> table;
+        return table;
+    }
+
+    ComponentTypeId ComponentRegistry::Next() noexcept {
+        static std::atomic<ComponentTypeId> next{ 0 };
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic_flag& ComponentRegistry::lock() noexcept {
+        static std::atomic_flag flag = ATOMIC_FLAG_INIT;
+        return flag;
+    }
+
+    void Component::RefreshHooks() {
+        if (Scene* scene = gameObject.GetScene())
+            scene->RefreshHooks(this);
+    }
+
+    void Component::Extract(RenderSnapshot& snapshot) {
+        snapshot.Begin(static_cast<uint8_t>(gameObject.layer));
+        OnExtract(snapshot);
+    }
+
+    void ComponentDeleter::operator()(Component* component) const noexcept {
+        if (!component) return;
+        if (component->m_pool)
+            component->m_pool->Destroy(component);
+        else if (SceneArena* arena = component->m_arena) {
+            component->~Component();
+            arena->Deallocate(component);
+        }
+        else
             delete component;
     }
 
+    void Component::Destroy(Component* component) {
+        if (!component || component->m_destroyed) return;
+        if (SceneManager::sceneManager && SceneManager::sceneManager->inParallelUpdate()) {
+            SceneManager::sceneManager->commands().Destroy(component); // rejoué après la phase parallèle
+            return;
+        }
+        if (Scene* scene = component->gameObject.GetScene())
+            scene->RemoveComponent(component);
+        else
+            component->gameObject.RemoveComponent(component);
+    }
+
     void Component::Destroy(GameObject* obj) {
-        if (obj)
-            obj->GetScene()->RemoveGameObject(obj);
+        if (!obj) return;
+        if (SceneManager::sceneManager && SceneManager::sceneManager->inParallelUpdate()) {
+            SceneManager::sceneManager->commands().Destroy(obj);
+            return;
+        }
+        obj->GetScene()->RemoveGameObject(obj);
     }
 
 }
\ No newline at end of file
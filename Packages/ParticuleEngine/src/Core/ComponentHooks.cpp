@@ -0,0 +1,72 @@
+#include <Particule/Engine/Core/ComponentHooks.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+
+namespace Particule::Engine {
+
+    ComponentHooks::~ComponentHooks()
+    {
+        for (List& list : m_lists)
+            for (Component* c : list.items)
+                if (c) c->m_hookOwner = nullptr;
+    }
+
+    void ComponentHooks::Add(Component* c)
+    {
+        if (!c || c->m_hookOwner == this) return;
+        if (c->m_hookOwner) c->m_hookOwner->Remove(c);
+        for (std::size_t h = 0; h < COMPONENT_HOOK_COUNT; ++h)
+        {
+            if (!(c->m_hookMask & (1u << h))) continue;
+            c->m_hookSlot[h] = static_cast<int32_t>(m_lists[h].items.size());
+            m_lists[h].items.push_back(c);
+        }
+        c->m_hookOwner = this;
+    }
+
+    void ComponentHooks::Remove(Component* c) noexcept
+    {
+        if (!c || c->m_hookOwner != this) return;
+        for (std::size_t h = 0; h < COMPONENT_HOOK_COUNT; ++h)
+        {
+            const int32_t slot = c->m_hookSlot[h];
+            if (slot < 0) continue;
+            List& list = m_lists[h];
+            if (list.iterating)
+            {
+                list.items[slot] = nullptr;
+                list.holes = true;
+            }
+            else
+            {
+                Component* last = list.items.back();
+                list.items[slot] = last;
+                last->m_hookSlot[h] = slot;
+                list.items.pop_back();
+            }
+            c->m_hookSlot[h] = -1;
+        }
+        c->m_hookOwner = nullptr;
+    }
+
+    void ComponentHooks::Compact(List& list, std::size_t hook) noexcept
+    {
+        std::size_t out = 0;
+        for (Component* c : list.items)
+        {
+            if (!c) continue;
+            c->m_hookSlot[hook] = static_cast<int32_t>(out);
+            list.items[out++] = c;
+        }
+        list.items.resize(out);
+        list.holes = false;
+    }
+
+    void ComponentHooks::EndDispatch(ComponentHook hook) noexcept
+    {
+        const std::size_t h = static_cast<std::size_t>(hook);
+        List& list = m_lists[h];
+        if (--list.iterating == 0 && list.holes)
+            Compact(list, h);
+    }
+
+}
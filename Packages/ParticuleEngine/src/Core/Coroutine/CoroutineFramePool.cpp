@@ -0,0 +1,59 @@
+#include <Particule/Engine/Core/Coroutine/Coroutine.hpp>
+#include <cstdlib>
+
+namespace Particule::Engine {
+
+    namespace {
+        constexpr std::size_t GRAIN = alignof(std::max_align_t);
+        constexpr std::size_t MAX_POOLED = 1024; // au-delà : tas
+        constexpr std::size_t CLASSES = MAX_POOLED / GRAIN;
+        constexpr std::size_t CHUNK = 4096;
+
+        struct FrameLists {
+            void* free[CLASSES] = {};
+            unsigned char* cursor = nullptr;
+            unsigned char* end = nullptr;
+        };
+
+        FrameLists& lists() noexcept {
+            static FrameLists l;
+            return l;
+        }
+
+        inline std::size_t classOf(std::size_t size) noexcept { return (size + GRAIN - 1) / GRAIN - 1; }
+    }
+
+    void* CoroutineFramePool::Allocate(std::size_t size) {
+        const std::size_t cls = classOf(size);
+        if (cls >= CLASSES)
+            return ::operator new(size);
+        FrameLists& l = lists();
+        if (void* p = l.free[cls]) {
+            l.free[cls] = *static_cast<void**>(p);
+            return p;
+        }
+        const std::size_t bytes = (cls + 1) * GRAIN;
+        if (static_cast<std::size_t>(l.end - l.cursor) < bytes) {
+            // Fin du bloc précédent abandonnée : au plus MAX_POOLED octets
+            l.cursor = static_cast<unsigned char*>(std::malloc(CHUNK));
+            if (!l.cursor) throw std::bad_alloc();
+            l.end = l.cursor + CHUNK;
+        }
+        void* p = l.cursor;
+        l.cursor += bytes;
+        return p;
+    }
+
+    void CoroutineFramePool::Deallocate(void* p, std::size_t size) noexcept {
+        if (!p) return;
+        const std::size_t cls = classOf(size);
+        if (cls >= CLASSES) {
+            ::operator delete(p);
+            return;
+        }
+        FrameLists& l = lists();
+        *static_cast<void**>(p) = l.free[cls];
+        l.free[cls] = p;
+    }
+
+}
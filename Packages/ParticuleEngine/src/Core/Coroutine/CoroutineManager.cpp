@@ -1,28 +1,136 @@
 #include <Particule/Engine/Core/Coroutine/CoroutineManager.hpp>
 #include <Particule/Engine/Core/Coroutine/Coroutine.hpp>
+#include <Particule/Core/System/App.hpp>
+#include <algorithm>
 
 namespace Particule::Engine {
 
-    CoroutineManager::CoroutineManager() : coroutines(0) {}
+    namespace {
+        // Tas-min sur une clé 32 bits qui reboucle
+        struct LaterWake {
+            template <typename S>
+            bool operator()(const S& a, const S& b) const noexcept { return static_cast<int32_t>(a.key - b.key) > 0; }
+        };
+    }
+
+    void Coroutine::stop() {
+        manuallyStopped = true;
+        if (slotIndex != NO_SLOT)
+            CoroutineManager::instance().wake(slotIndex);
+    }
+
+    CoroutineManager::CoroutineManager() : chunks(0), freeSlots(0), polled(0), timeHeap(0), frameHeap(0), due(0) {}
 
     Coroutine* CoroutineManager::start(Coroutine&& co) {
-        coroutines.emplace_back(std::make_unique<Coroutine>(std::move(co)));
-        return coroutines.back().get();
+        if (freeSlots.empty()) {
+            const uint32_t base = static_cast<uint32_t>(chunks.size() * CHUNK);
+            chunks.push_back(std::make_unique<Slot[]>(CHUNK));
+            for (uint32_t i = 0; i < CHUNK; ++i)
+                chunks.back()[i].co.slotIndex = base + i;
+            for (uint32_t i = CHUNK; i-- > 0; )
+                freeSlots.push_back(base + i);
+        }
+        const uint32_t index = freeSlots.back();
+        freeSlots.pop_back();
+        Slot& s = slot(index);
+        s.co = std::move(co);
+        ++liveCount;
+        addPolled(index); // premier lancement à la prochaine passe
+        return &s.co;
     }
 
     void CoroutineManager::stop(Coroutine& coroutine) {
         coroutine.stop();
     }
 
+    void CoroutineManager::addPolled(uint32_t index) {
+        Slot& s = slot(index);
+        if (s.polledPos >= 0) return;
+        s.polledPos = static_cast<int32_t>(polled.size());
+        polled.push_back(index);
+    }
+
+    void CoroutineManager::removePolled(uint32_t index) noexcept {
+        Slot& s = slot(index);
+        if (s.polledPos < 0) return;
+        const uint32_t last = polled.back();
+        polled[s.polledPos] = last;
+        slot(last).polledPos = s.polledPos;
+        polled.pop_back();
+        s.polledPos = -1;
+    }
+
+    void CoroutineManager::wake(uint32_t index) {
+        Slot& s = slot(index);
+        if (s.polledPos >= 0 || !s.co.handle) return; // déjà interrogée ou emplacement libre
+        ++s.generation; // son entrée de tas devient périmée
+        addPolled(index);
+    }
+
+    void CoroutineManager::retire(uint32_t index) noexcept {
+        Slot& s = slot(index);
+        removePolled(index);
+        ++s.generation;
+        s.co = Coroutine{ Coroutine::handle_type{} }; // libère le cadre
+        freeSlots.push_back(index);
+        --liveCount;
+    }
+
+    void CoroutineManager::run(uint32_t index) {
+        Slot& s = slot(index);
+        if (!s.co.is_done()) s.co.update();
+        if (s.co.is_done()) {
+            retire(index);
+            return;
+        }
+        uint32_t key = 0;
+        switch (s.co.pendingWait(key)) {
+            case CoroutineWait::Time:
+                removePolled(index);
+                timeHeap.push_back({ key, index, s.generation });
+                std::push_heap(timeHeap.begin(), timeHeap.end(), LaterWake{});
+                break;
+            case CoroutineWait::Frames:
+                removePolled(index);
+                frameHeap.push_back({ key, index, s.generation });
+                std::push_heap(frameHeap.begin(), frameHeap.end(), LaterWake{});
+                break;
+            default:
+                addPolled(index);
+                break;
+        }
+    }
+
+    void CoroutineManager::popDue(std::vector<Sleeper>& heap, uint32_t now) {
+        while (!heap.empty() && CoroutineClock::reached(now, heap.front().key)) {
+            const Sleeper top = heap.front();
+            std::pop_heap(heap.begin(), heap.end(), LaterWake{});
+            heap.pop_back();
+            if (slot(top.slot).generation == top.generation)
+                due.push_back(top);
+        }
+    }
+
     void CoroutineManager::update() {
-        for (auto it = coroutines.begin(); it != coroutines.end(); ) {
-            if ((*it)->is_done())
-                it = coroutines.erase(it);
-            else {
-                (*it)->update();
-                ++it;
-            }
+        CoroutineClock::nowUs = Particule::Core::App::time.TimeSinceStart();
+        ++CoroutineClock::frame;
+
+        // Échéances relevées avant toute reprise : une coroutine ne reprend qu'une fois par frame
+        due.clear();
+        popDue(timeHeap, CoroutineClock::nowUs);
+        popDue(frameHeap, CoroutineClock::frame);
+
+        // Liste interrogée : un élément retiré est remplacé par le dernier, traité au tour suivant
+        for (std::size_t i = 0; i < polled.size(); ) {
+            const uint32_t index = polled[i];
+            run(index);
+            if (i < polled.size() && polled[i] == index) ++i;
         }
+
+        // Génération revérifiée : la passe précédente a pu réveiller (stop) ou recycler l'emplacement
+        for (std::size_t i = 0; i < due.size(); ++i)
+            if (slot(due[i].slot).generation == due[i].generation)
+                run(due[i].slot);
     }
 
     CoroutineManager& CoroutineManager::instance() {
@@ -30,4 +138,4 @@ namespace Particule::Engine {
         return mgr;
     }
 
-}
\ No newline at end of file
+}
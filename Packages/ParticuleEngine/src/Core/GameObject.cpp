@@ -3,6 +3,7 @@
 #include <Particule/Engine/Core/Transform.hpp>
 #include <Particule/Engine/Scene/Scene.hpp>
 #include <Particule/Engine/Scene/SceneManager.hpp>
+#include <algorithm>
 
 namespace Particule::Engine {
 
@@ -11,6 +12,7 @@ namespace Particule::Engine {
 
     GameObject::GameObject(Scene *scene, std::string name)
         : m_activeSelf(true)
+        , m_activeInHierarchy(true)
         , scene(scene)
         , components()                       // 3) matches declaration
         , transform(*this)                   // 4)
@@ -20,6 +22,17 @@ namespace Particule::Engine {
         , isStatic(false)                    // 8)
     {}
 
+    void GameObjectDeleter::operator()(GameObject* go) const noexcept
+    {
+        if (!go) return;
+        if (SceneArena* arena = go->m_arena) {
+            go->~GameObject();
+            arena->Deallocate(go);
+        }
+        else
+            delete go;
+    }
+
     GameObject::~GameObject()
     {
         this->components.clear();
@@ -29,50 +42,53 @@ namespace Particule::Engine {
             this->scene->RemoveGameObject(this);
     }
 
-    void GameObject::SetActive(bool value)
+    void GameObject::RemoveComponent(Component* component) noexcept
     {
-        const bool parentActive =
-            (transform.parent() == nullptr)
-                ? true
-                : transform.parent()->gameObject.activeInHierarchy();
+        auto it = std::find_if(components.begin(), components.end(),
+            [&](const ComponentPtr& up){ return up.get() == component; });
+        if (it == components.end()) return;
+        componentIndex.erase(std::find_if(componentIndex.begin(), componentIndex.end(),
+            [&](const ComponentEntry& e){ return e.component == component; }));
+        componentMask = 0;
+        for (const ComponentEntry& e : componentIndex)
+            componentMask |= uint64_t(1) << (e.type & 63);
+        components.erase(it); // ComponentDeleter : retour au pool ou delete ; le destructeur quitte les hooks
+    }
 
-        const bool wasSelf = m_activeSelf;
-        const bool was     = parentActive && wasSelf;
+    void GameObject::UpdateActiveInHierarchy(std::vector<GameObject*>& changed)
+    {
+        const Transform* parent = transform.parent();
+        const bool now = m_activeSelf && (parent == nullptr || parent->gameObject.m_activeInHierarchy);
+        // Inchangé : les descendants le sont aussi
+        if (now == m_activeInHierarchy) return;
+        m_activeInHierarchy = now;
+        changed.push_back(this);
+        for (Transform* ct : transform.children())
+            ct->gameObject.UpdateActiveInHierarchy(changed);
+    }
 
+    void GameObject::SetActive(bool value)
+    {
+        if (m_activeSelf == value) return;
         m_activeSelf = value;
 
-        const bool now = parentActive && m_activeSelf;
-
-        // Notifie this si son état effectif change
-        if (was != now) {
-            if (now) CallComponents(&Component::OnEnable, false);
-            else     CallComponents(&Component::OnDisable, false);
-        } else {
-            // Si rien ne change pour this, rien ne change pour les descendants
-            return;
+        // Tous les caches d'abord : les callbacks voient un état cohérent dans tout le sous-arbre
+        std::vector<GameObject*> changed;
+        UpdateActiveInHierarchy(changed);
+        for (GameObject* go : changed) {
+            if (go->m_activeInHierarchy) go->CallComponents(&Component::OnEnable, false);
+            else                         go->CallComponents(&Component::OnDisable, false);
+            if (go->scene) go->scene->RefreshHooks(go);
         }
-
-        // Propage proprement aux enfants
-        auto propagate = [&](auto&& self, GameObject* parent, bool parentWas, bool parentNow) -> void {
-            auto& kids = parent->transform.children();
-            for (Transform* ct : kids) {
-                GameObject* child = &ct->gameObject;
-
-                const bool childSelf = child->activeSelf();
-                const bool childWas  = parentWas && childSelf;
-                const bool childNow  = parentNow && childSelf;
-
-                if (childWas != childNow) {
-                    if (childNow) child->CallComponents(&Component::OnEnable, false);
-                    else          child->CallComponents(&Component::OnDisable, false);
-                }
-
-                self(self, child, childWas, childNow);
-            }
-        };
-
-        propagate(propagate, this, was, now);
     }
 
+    // Reparentage : mise à jour du cache et des hooks, sans OnEnable/OnDisable (comme avant)
+    void Transform::onParentChanged() noexcept
+    {
+        std::vector<GameObject*> changed;
+        gameObject.UpdateActiveInHierarchy(changed);
+        for (GameObject* go : changed)
+            if (go->scene) go->scene->RefreshHooks(go);
+    }
 
 }
\ No newline at end of file
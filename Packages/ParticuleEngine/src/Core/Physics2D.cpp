@@ -0,0 +1,696 @@
+#include <Particule/Engine/Core/Physics2D.hpp>
+#include <Particule/Engine/Components/Rigidbody2D.hpp>
+#include <Particule/Engine/Components/Collider2D.hpp>
+#include <Particule/Engine/Enum/Layer.hpp>
+#include <algorithm>
+#include <numeric>
+
+namespace Particule::Engine {
+
+    namespace
+    {
+        constexpr int SHIFT = 16;
+        constexpr int64_t ONE = int64_t(1) << SHIFT;
+        constexpr std::size_t FULL_SORT = 32; // au-delà, les ajouts sont triés d'un coup plutôt que par insertion
+
+        uint64_t ISqrt(uint64_t v) noexcept
+        {
+            uint64_t result = 0;
+            uint64_t bit = uint64_t(1) << 62;
+            while (bit > v) bit >>= 2;
+            while (bit)
+            {
+                if (v >= result + bit)
+                {
+                    v -= result + bit;
+                    result = (result >> 1) + bit;
+                }
+                else
+                    result >>= 1;
+                bit >>= 2;
+            }
+            return result;
+        }
+
+        inline int32_t Clamp32(int64_t v) noexcept
+        {
+            return static_cast<int32_t>(std::clamp<int64_t>(v, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()));
+        }
+
+        inline int32_t From12(fixed12_32 v) noexcept { return Clamp32(int64_t(v.raw()) << 4); }
+
+        inline bool IsDynamic(const Rigidbody2D* b) noexcept { return b && b->isDynamic(); }
+
+        // Pousse les autres corps ce pas : dynamique éveillé, ou cinématique en mouvement
+        inline bool IsMoving(const Rigidbody2D* b) noexcept
+        {
+            if (!b) return false;
+            if (b->isDynamic()) return b->IsAwake();
+            return b->velocity().x != 0 || b->velocity().y != 0;
+        }
+
+        // Masse inverse dans le solveur : un corps endormi ou cinématique ne bouge pas
+        inline int64_t SolverInvMass(const Rigidbody2D* b) noexcept
+        {
+            return IsDynamic(b) && b->IsAwake() ? b->inverseMass().raw() : 0;
+        }
+
+        // Distance parcourue en un pas (norme 1) : marge des contacts spéculatifs
+        inline int64_t Travel(const Rigidbody2D* b, int64_t dt) noexcept
+        {
+            if (!IsMoving(b)) return 0;
+            const int64_t vx = b->velocity().x.raw(), vy = b->velocity().y.raw();
+            return (((vx < 0 ? -vx : vx) + (vy < 0 ? -vy : vy)) * dt) >> SHIFT;
+        }
+
+        inline bool AxisLess(int32_t minA, uint32_t shapeA, int32_t minB, uint32_t shapeB) noexcept
+        {
+            return minA < minB || (minA == minB && shapeA < shapeB);
+        }
+    }
+
+    void PhysicsWorld2D::LoadShape(Shape& s)
+    {
+        const Collider2D& c = *s.collider;
+        s.offsetX = c.m_offset.x.raw();
+        s.offsetY = c.m_offset.y.raw();
+        if (c.m_shape == ColliderShape2D::Box)
+        {
+            const Vector2<fixed16_32>& size = static_cast<const BoxCollider2D&>(c).size();
+            s.kind = ShapeKind::Box;
+            s.halfX = std::abs(size.x.raw()) / 2;
+            s.halfY = std::abs(size.y.raw()) / 2;
+        }
+        else
+        {
+            s.kind = ShapeKind::Circle;
+            s.halfX = s.halfY = std::abs(static_cast<const CircleCollider2D&>(c).radius().raw());
+        }
+        s.layerBit = LayerBit(c.gameObject.layer);
+        s.mask = c.m_collisionMask;
+        s.friction = c.m_friction.raw();
+        s.bounciness = c.m_bounciness.raw();
+    }
+
+    void PhysicsWorld2D::UpdateBounds(Shape& s)
+    {
+        int32_t x, y;
+        if (s.body)
+        {
+            x = s.body->m_position.x.raw();
+            y = s.body->m_position.y.raw();
+        }
+        else
+        {
+            Transform& t = s.collider->gameObject.transform;
+            const Vector3<fixed12_32> p = t.position;
+            x = From12(p.x);
+            y = From12(p.y);
+            s.stamp = t.worldStamp();
+        }
+        s.centerX = Clamp32(int64_t(x) + s.offsetX);
+        s.centerY = Clamp32(int64_t(y) + s.offsetY);
+        s.minX = Clamp32(int64_t(s.centerX) - s.halfX);
+        s.maxX = Clamp32(int64_t(s.centerX) + s.halfX);
+        s.minY = Clamp32(int64_t(s.centerY) - s.halfY);
+        s.maxY = Clamp32(int64_t(s.centerY) + s.halfY);
+    }
+
+    void PhysicsWorld2D::Attach(uint32_t shape, Rigidbody2D* body)
+    {
+        Shape& s = m_shapes[shape];
+        s.body = body;
+        if (body)
+        {
+            s.next = body->m_firstShape;
+            body->m_firstShape = shape;
+        }
+        UpdateBounds(s);
+    }
+
+    void PhysicsWorld2D::Detach(uint32_t shape) noexcept
+    {
+        Shape& s = m_shapes[shape];
+        if (!s.body) return;
+        uint32_t* link = &s.body->m_firstShape;
+        while (*link != shape) link = &m_shapes[*link].next;
+        *link = s.next;
+        s.body = nullptr;
+        s.next = NONE;
+    }
+
+    void PhysicsWorld2D::AddBody(Rigidbody2D& body)
+    {
+        const Vector3<fixed12_32> p = body.gameObject.transform.position;
+        body.m_written = Vector2<fixed12_32>(p.x, p.y);
+        body.m_position = Vector2<fixed16_32>(fixed16_32(From12(p.x), true), fixed16_32(From12(p.y), true));
+        body.m_firstShape = NONE;
+        body.WakeUp();
+        body.m_handle.world = this;
+        body.m_handle.id = static_cast<uint32_t>(m_bodies.size());
+        m_bodies.push_back(&body);
+        for (Collider2D* c : body.gameObject.Components<Collider2D>())
+            if (c->m_handle.world == this && !m_shapes[c->m_handle.id].body)
+                Attach(c->m_handle.id, &body);
+    }
+
+    void PhysicsWorld2D::RemoveBody(uint32_t id) noexcept
+    {
+        if (id >= m_bodies.size()) return;
+        Rigidbody2D* body = m_bodies[id];
+        // Les colliders restent inscrits, statiques à la position du transform
+        for (uint32_t shape = body->m_firstShape; shape != NONE;)
+        {
+            Shape& s = m_shapes[shape];
+            shape = s.next;
+            s.body = nullptr;
+            s.next = NONE;
+            UpdateBounds(s);
+        }
+        body->m_firstShape = NONE;
+        m_bodies[id] = m_bodies.back();
+        m_bodies[id]->m_handle.id = id;
+        m_bodies.pop_back();
+        body->m_handle = PhysicsHandle{};
+    }
+
+    void PhysicsWorld2D::AddShape(Collider2D& collider)
+    {
+        uint32_t id;
+        if (!m_freeShapes.empty())
+        {
+            id = m_freeShapes.back();
+            m_freeShapes.pop_back();
+        }
+        else
+        {
+            id = static_cast<uint32_t>(m_shapes.size());
+            m_shapes.emplace_back();
+        }
+        Shape& s = m_shapes[id];
+        s = Shape{};
+        s.collider = &collider;
+        LoadShape(s);
+        collider.m_handle.world = this;
+        collider.m_handle.id = id;
+        Rigidbody2D* body = collider.gameObject.GetComponent<Rigidbody2D>();
+        Attach(id, body && body->m_handle.world == this ? body : nullptr);
+        m_axis.push_back(AxisEntry{ s.minX, s.maxX, s.minY, s.maxY, id });
+        ++m_unsorted;
+    }
+
+    void PhysicsWorld2D::RemoveShape(uint32_t id) noexcept
+    {
+        if (id >= m_shapes.size() || !m_shapes[id].collider) return;
+        Collider2D* removed = m_shapes[id].collider;
+        Rigidbody2D* removedBody = m_shapes[id].body;
+        Detach(id);
+        auto it = std::find_if(m_axis.begin(), m_axis.end(), [id](const AxisEntry& e) { return e.shape == id; });
+        if (it != m_axis.end())
+        {
+            if (m_axis.end() - it <= static_cast<std::ptrdiff_t>(m_unsorted)) --m_unsorted;
+            m_axis.erase(it);
+        }
+        // Son identifiant pourra être réattribué : ses paires disparaissent tout de suite
+        auto involves = [id](uint64_t key) { return uint32_t(key >> 32) == id || uint32_t(key) == id; };
+        std::vector<std::pair<uint32_t, Collider2D*>> ended;
+        for (uint64_t key : m_touching)
+            if (involves(key))
+            {
+                const uint32_t other = uint32_t(key >> 32) == id ? uint32_t(key) : uint32_t(key >> 32);
+                ended.emplace_back(other, m_shapes[other].collider);
+            }
+        m_touching.erase(std::remove_if(m_touching.begin(), m_touching.end(), involves), m_touching.end());
+        m_cache.erase(std::remove_if(m_cache.begin(), m_cache.end(), [&](const Cached& e) { return involves(e.key); }), m_cache.end());
+        Shape& s = m_shapes[id];
+        s.collider->m_handle = PhysicsHandle{};
+        s = Shape{};
+        m_freeShapes.push_back(id);
+
+        // OnCollisionExit tout de suite pour les colliders qu'il touchait, s'ils sont encore inscrits ; pas pour
+        // le collider retiré, désactivé ou en destruction (ses voisins sur le GameObject peuvent déjà être détruits)
+        const Vector2<fixed16_32> zero(fixed16_32(0), fixed16_32(0));
+        for (const auto& [other, collider] : ended)
+        {
+            if (m_shapes[other].collider != collider) continue; // retiré par un appel précédent
+            Collision2D collision{ collider, removed, removedBody, zero, zero };
+            collider->gameObject.CallComponents(&Component::OnCollisionExit, false, collision);
+        }
+    }
+
+    void PhysicsWorld2D::RefreshShape(uint32_t id)
+    {
+        if (id >= m_shapes.size() || !m_shapes[id].collider) return;
+        LoadShape(m_shapes[id]);
+        UpdateBounds(m_shapes[id]);
+    }
+
+    void PhysicsWorld2D::MoveObject(GameObject& go, PhysicsWorld2D& dst)
+    {
+        if (&dst == this) return;
+        for (Rigidbody2D* body : go.Components<Rigidbody2D>())
+            if (body->m_handle.world == this)
+            {
+                RemoveBody(body->m_handle.id);
+                dst.AddBody(*body);
+            }
+        for (Collider2D* c : go.Components<Collider2D>())
+            if (c->m_handle.world == this)
+            {
+                RemoveShape(c->m_handle.id);
+                dst.AddShape(*c);
+            }
+    }
+
+    void PhysicsWorld2D::SyncBodies()
+    {
+        const int64_t dt = timeStep.raw();
+        for (Rigidbody2D* b : m_bodies)
+        {
+            // Transform déplacé depuis le dernier pas : téléportation
+            const Vector3<fixed12_32> p = b->gameObject.transform.position;
+            if (p.x != b->m_written.x || p.y != b->m_written.y)
+            {
+                b->m_written = Vector2<fixed12_32>(p.x, p.y);
+                b->m_position = Vector2<fixed16_32>(fixed16_32(From12(p.x), true), fixed16_32(From12(p.y), true));
+                b->WakeUp();
+            }
+            if (b->isDynamic() && b->m_awake)
+            {
+                const int64_t gs = b->gravityScale.raw(), inv = b->m_invMass.raw();
+                const int64_t ax = ((gravity.x.raw() * gs) >> SHIFT) + ((b->m_force.x.raw() * inv) >> SHIFT);
+                const int64_t ay = ((gravity.y.raw() * gs) >> SHIFT) + ((b->m_force.y.raw() * inv) >> SHIFT);
+                int64_t vx = b->m_velocity.x.raw() + ((ax * dt) >> SHIFT);
+                int64_t vy = b->m_velocity.y.raw() + ((ay * dt) >> SHIFT);
+                if (b->drag > 0)
+                {
+                    const int64_t k = std::min<int64_t>((int64_t(b->drag.raw()) * dt) >> SHIFT, ONE);
+                    vx -= (vx * k) >> SHIFT;
+                    vy -= (vy * k) >> SHIFT;
+                }
+                b->m_velocity = Vector2<fixed16_32>(fixed16_32(Clamp32(vx), true), fixed16_32(Clamp32(vy), true));
+            }
+            b->m_force = Vector2<fixed16_32>(fixed16_32(0), fixed16_32(0));
+        }
+    }
+
+    void PhysicsWorld2D::Broadphase()
+    {
+        // Bornes des colliders qui ont pu bouger ; les statiques seulement si leur transform a changé.
+        // Élargies de slop (un objet posé reste en contact), et pour un corps en mouvement de son déplacement du pas
+        const int64_t dt = timeStep.raw(), skin = slop.raw();
+        for (AxisEntry& e : m_axis)
+        {
+            Shape& s = m_shapes[e.shape];
+            s.layerBit = LayerBit(s.collider->gameObject.layer);
+            if (s.body ? IsMoving(s.body) || !s.body->isDynamic() : s.collider->gameObject.transform.worldStamp() != s.stamp)
+                UpdateBounds(s);
+            int64_t dx = 0, dy = 0;
+            if (IsMoving(s.body))
+            {
+                dx = (int64_t(s.body->m_velocity.x.raw()) * dt) >> SHIFT;
+                dy = (int64_t(s.body->m_velocity.y.raw()) * dt) >> SHIFT;
+            }
+            e.minX = Clamp32(s.minX - skin + std::min<int64_t>(dx, 0)); e.maxX = Clamp32(s.maxX + skin + std::max<int64_t>(dx, 0));
+            e.minY = Clamp32(s.minY - skin + std::min<int64_t>(dy, 0)); e.maxY = Clamp32(s.maxY + skin + std::max<int64_t>(dy, 0));
+        }
+
+        // Liste persistante : presque triée d'un pas à l'autre, l'insertion est quasi linéaire
+        if (m_unsorted > FULL_SORT)
+            std::sort(m_axis.begin(), m_axis.end(), [](const AxisEntry& a, const AxisEntry& b) {
+                return AxisLess(a.minX, a.shape, b.minX, b.shape);
+            });
+        else
+            for (std::size_t i = 1; i < m_axis.size(); ++i)
+            {
+                const AxisEntry e = m_axis[i];
+                std::size_t j = i;
+                for (; j > 0 && AxisLess(e.minX, e.shape, m_axis[j - 1].minX, m_axis[j - 1].shape); --j)
+                    m_axis[j] = m_axis[j - 1];
+                m_axis[j] = e;
+            }
+        m_unsorted = 0;
+
+        m_contacts.clear();
+        m_links.clear();
+        const std::size_t n = m_axis.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const AxisEntry& ei = m_axis[i];
+            for (std::size_t j = i + 1; j < n && m_axis[j].minX <= ei.maxX; ++j)
+            {
+                const AxisEntry& ej = m_axis[j];
+                if (ei.maxY < ej.minY || ej.maxY < ei.minY) continue;
+                const Shape& si = m_shapes[ei.shape];
+                const Shape& sj = m_shapes[ej.shape];
+                if (!IsDynamic(si.body) && !IsDynamic(sj.body)) continue; // statiques et cinématiques entre eux
+                if (si.body == sj.body) continue;
+                if (!(si.mask & sj.layerBit) || !(sj.mask & si.layerBit)) continue;
+                const uint32_t a = std::min(ei.shape, ej.shape), b = std::max(ei.shape, ej.shape);
+                if (IsMoving(si.body) || IsMoving(sj.body))
+                {
+                    Contact c;
+                    if (Collide(a, b, 2 * skin + Travel(si.body, dt) + Travel(sj.body, dt), c))
+                        m_contacts.push_back(c);
+                }
+                else
+                    m_links.push_back(PairKey(a, b)); // personne ne bouge : garde l'îlot et l'état du contact
+            }
+        }
+    }
+
+    bool PhysicsWorld2D::Collide(uint32_t a, uint32_t b, int64_t margin, Contact& c) const
+    {
+        const Shape& A = m_shapes[a];
+        const Shape& B = m_shapes[b];
+        int64_t nx, ny, pen, px, py;
+        if (A.kind == ShapeKind::Box && B.kind == ShapeKind::Box)
+        {
+            const int64_t dx = int64_t(B.centerX) - A.centerX, dy = int64_t(B.centerY) - A.centerY;
+            const int64_t ox = int64_t(A.halfX) + B.halfX - (dx < 0 ? -dx : dx);
+            const int64_t oy = int64_t(A.halfY) + B.halfY - (dy < 0 ? -dy : dy);
+            if (ox < -margin || oy < -margin) return false;
+            // Axe de moindre pénétration (ou de plus grande séparation)
+            if (ox < oy) { nx = dx < 0 ? -ONE : ONE; ny = 0; pen = ox; }
+            else         { nx = 0; ny = dy < 0 ? -ONE : ONE; pen = oy; }
+            px = (int64_t(std::max(A.minX, B.minX)) + std::min(A.maxX, B.maxX)) / 2;
+            py = (int64_t(std::max(A.minY, B.minY)) + std::min(A.maxY, B.maxY)) / 2;
+        }
+        else if (A.kind == ShapeKind::Circle && B.kind == ShapeKind::Circle)
+        {
+            const int64_t dx = int64_t(B.centerX) - A.centerX, dy = int64_t(B.centerY) - A.centerY;
+            const int64_t r = int64_t(A.halfX) + B.halfX;
+            const uint64_t d2 = uint64_t(dx * dx) + uint64_t(dy * dy);
+            if (d2 > uint64_t((r + margin) * (r + margin))) return false;
+            const int64_t dist = static_cast<int64_t>(ISqrt(d2));
+            if (dist == 0) { nx = 0; ny = ONE; pen = r; }
+            else { nx = dx * ONE / dist; ny = dy * ONE / dist; pen = r - dist; }
+            px = A.centerX + ((nx * A.halfX) >> SHIFT);
+            py = A.centerY + ((ny * A.halfX) >> SHIFT);
+        }
+        else
+        {
+            // Boîte / cercle, normale de la boîte vers le cercle
+            const bool boxFirst = A.kind == ShapeKind::Box;
+            const Shape& box = boxFirst ? A : B;
+            const Shape& circle = boxFirst ? B : A;
+            const int64_t r = circle.halfX;
+            const int64_t rx = int64_t(circle.centerX) - box.centerX, ry = int64_t(circle.centerY) - box.centerY;
+            const int64_t qx = std::clamp<int64_t>(rx, -box.halfX, box.halfX);
+            const int64_t qy = std::clamp<int64_t>(ry, -box.halfY, box.halfY);
+            if (qx == rx && qy == ry)
+            {
+                // Centre dans la boîte : sortie par la face la plus proche
+                const int64_t fx = box.halfX - (rx < 0 ? -rx : rx), fy = box.halfY - (ry < 0 ? -ry : ry);
+                if (fx < fy) { nx = rx < 0 ? -ONE : ONE; ny = 0; pen = r + fx; px = box.centerX + (rx < 0 ? -box.halfX : box.halfX); py = circle.centerY; }
+                else         { nx = 0; ny = ry < 0 ? -ONE : ONE; pen = r + fy; px = circle.centerX; py = box.centerY + (ry < 0 ? -box.halfY : box.halfY); }
+            }
+            else
+            {
+                const int64_t dx = rx - qx, dy = ry - qy;
+                const uint64_t d2 = uint64_t(dx * dx) + uint64_t(dy * dy);
+                if (d2 > uint64_t((r + margin) * (r + margin))) return false;
+                const int64_t dist = static_cast<int64_t>(ISqrt(d2));
+                if (dist == 0) return false; // ne peut arriver : centre hors de la boîte
+                nx = dx * ONE / dist;
+                ny = dy * ONE / dist;
+                pen = r - dist;
+                px = box.centerX + qx;
+                py = box.centerY + qy;
+            }
+            if (!boxFirst) { nx = -nx; ny = -ny; }
+        }
+        c.a = a;
+        c.b = b;
+        c.bodyA = A.body;
+        c.bodyB = B.body;
+        c.nx = static_cast<int32_t>(nx);
+        c.ny = static_cast<int32_t>(ny);
+        c.penetration = Clamp32(pen);
+        c.px = Clamp32(px);
+        c.py = Clamp32(py);
+        c.friction = static_cast<int32_t>((int64_t(A.friction) + B.friction) / 2);
+        c.bias = std::max(A.bounciness, B.bounciness); // converti en vitesse visée dans Solve
+        c.massNormal = 0;
+        c.normalImpulse = c.tangentImpulse = 0;
+        return true;
+    }
+
+    uint32_t PhysicsWorld2D::Find(uint32_t body) noexcept
+    {
+        while (m_parent[body] != body)
+        {
+            m_parent[body] = m_parent[m_parent[body]];
+            body = m_parent[body];
+        }
+        return body;
+    }
+
+    void PhysicsWorld2D::Islands()
+    {
+        constexpr uint8_t BUSY = 1;
+        const uint32_t n = static_cast<uint32_t>(m_bodies.size());
+        m_parent.resize(n);
+        std::iota(m_parent.begin(), m_parent.end(), 0u);
+        m_islandFlags.assign(n, 0);
+        auto unite = [this](const Rigidbody2D* x, const Rigidbody2D* y) {
+            if (!IsDynamic(x) || !IsDynamic(y)) return; // statiques et cinématiques ne relient pas les îlots
+            const uint32_t rx = Find(x->m_handle.id), ry = Find(y->m_handle.id);
+            if (rx < ry) m_parent[ry] = rx;
+            else if (ry < rx) m_parent[rx] = ry;
+        };
+        for (const Contact& c : m_contacts)
+            unite(c.bodyA, c.bodyB);
+        for (uint64_t key : m_links)
+            unite(m_shapes[uint32_t(key >> 32)].body, m_shapes[uint32_t(key)].body);
+
+        // Un îlot reste éveillé si un de ses corps bouge, ou s'il est poussé par un cinématique
+        for (const Contact& c : m_contacts)
+        {
+            if (IsMoving(c.bodyA) && !IsDynamic(c.bodyA) && IsDynamic(c.bodyB)) m_islandFlags[Find(c.bodyB->m_handle.id)] |= BUSY;
+            if (IsMoving(c.bodyB) && !IsDynamic(c.bodyB) && IsDynamic(c.bodyA)) m_islandFlags[Find(c.bodyA->m_handle.id)] |= BUSY;
+        }
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            const Rigidbody2D* b = m_bodies[i];
+            if (b->isDynamic() && b->m_awake && (!b->allowSleep || b->m_restFrames < sleepFrames))
+                m_islandFlags[Find(i)] |= BUSY;
+        }
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            Rigidbody2D* b = m_bodies[i];
+            if (!b->isDynamic()) continue;
+            const bool busy = m_islandFlags[Find(i)] & BUSY;
+            if (busy && !b->m_awake) b->WakeUp();
+            else if (!busy && b->m_awake) b->Sleep();
+        }
+    }
+
+    void PhysicsWorld2D::Solve()
+    {
+        auto velocity = [](const Rigidbody2D* b, int64_t& vx, int64_t& vy) {
+            vx = b ? b->m_velocity.x.raw() : 0;
+            vy = b ? b->m_velocity.y.raw() : 0;
+        };
+        auto apply = [](Rigidbody2D* b, int64_t inv, int64_t jx, int64_t jy) {
+            if (!inv) return;
+            b->m_velocity.x = fixed16_32(Clamp32(b->m_velocity.x.raw() + ((jx * inv) >> SHIFT)), true);
+            b->m_velocity.y = fixed16_32(Clamp32(b->m_velocity.y.raw() + ((jy * inv) >> SHIFT)), true);
+        };
+
+        const int64_t threshold = sleepSpeed.raw(), dt = timeStep.raw();
+        for (Contact& c : m_contacts)
+        {
+            const int64_t sum = SolverInvMass(c.bodyA) + SolverInvMass(c.bodyB);
+            if (!sum)
+            {
+                // Îlot endormi ce pas : le contact garde son état
+                c.bias = 0;
+                c.touching = c.penetration >= 0 || std::binary_search(m_touching.begin(), m_touching.end(), PairKey(c.a, c.b));
+                continue;
+            }
+            c.massNormal = (ONE * ONE) / sum;
+            int64_t vax, vay, vbx, vby;
+            velocity(c.bodyA, vax, vay);
+            velocity(c.bodyB, vbx, vby);
+            const int64_t vn = ((vbx - vax) * c.nx + (vby - vay) * c.ny) >> SHIFT;
+            const int64_t bounciness = c.bias;
+            // Spéculatif : seule l'approche qui comble la séparation pendant le pas est permise
+            c.bias = c.penetration < 0 ? (int64_t(c.penetration) << SHIFT) / dt : 0;
+            c.touching = c.penetration >= 0 || ((-vn * dt) >> SHIFT) >= -int64_t(c.penetration);
+            if (!c.touching) continue;
+            // Rebond seulement au-dessus de la vitesse de repos : pas de tremblement des objets posés
+            if (vn < -threshold && bounciness)
+                c.bias = std::max(c.bias, -((vn * bounciness) >> SHIFT));
+
+            // Contact déjà présent au pas précédent avec la même normale : on repart de ses impulsions
+            const uint64_t key = PairKey(c.a, c.b);
+            auto it = std::lower_bound(m_cache.begin(), m_cache.end(), key, [](const Cached& e, uint64_t k) { return e.key < k; });
+            if (it != m_cache.end() && it->key == key && it->nx == c.nx && it->ny == c.ny)
+            {
+                c.normalImpulse = it->normalImpulse;
+                c.tangentImpulse = it->tangentImpulse;
+                const int64_t jx = (c.normalImpulse * c.nx - c.tangentImpulse * c.ny) >> SHIFT;
+                const int64_t jy = (c.normalImpulse * c.ny + c.tangentImpulse * c.nx) >> SHIFT;
+                apply(c.bodyA, SolverInvMass(c.bodyA), -jx, -jy);
+                apply(c.bodyB, SolverInvMass(c.bodyB), jx, jy);
+            }
+        }
+
+        for (int it = 0; it < velocityIterations; ++it)
+            for (Contact& c : m_contacts)
+            {
+                if (!c.massNormal) continue;
+                const int64_t invA = SolverInvMass(c.bodyA), invB = SolverInvMass(c.bodyB);
+                int64_t vax, vay, vbx, vby;
+                velocity(c.bodyA, vax, vay);
+                velocity(c.bodyB, vbx, vby);
+
+                // Normale : impulsion cumulée jamais négative (les corps ne s'attirent pas)
+                const int64_t vn = ((vbx - vax) * c.nx + (vby - vay) * c.ny) >> SHIFT;
+                int64_t lambda = ((c.bias - vn) * c.massNormal) >> SHIFT;
+                const int64_t normal = std::max<int64_t>(c.normalImpulse + lambda, 0);
+                lambda = normal - c.normalImpulse;
+                c.normalImpulse = normal;
+                int64_t jx = (lambda * c.nx) >> SHIFT, jy = (lambda * c.ny) >> SHIFT;
+                apply(c.bodyA, invA, -jx, -jy);
+                apply(c.bodyB, invB, jx, jy);
+
+                // Tangente : frottement de Coulomb, borné par friction * impulsion normale
+                velocity(c.bodyA, vax, vay);
+                velocity(c.bodyB, vbx, vby);
+                const int64_t tx = -c.ny, ty = c.nx;
+                const int64_t vt = ((vbx - vax) * tx + (vby - vay) * ty) >> SHIFT;
+                const int64_t maxFriction = (c.normalImpulse * c.friction) >> SHIFT;
+                lambda = (-vt * c.massNormal) >> SHIFT;
+                const int64_t tangent = std::clamp<int64_t>(c.tangentImpulse + lambda, -maxFriction, maxFriction);
+                lambda = tangent - c.tangentImpulse;
+                c.tangentImpulse = tangent;
+                jx = (lambda * tx) >> SHIFT;
+                jy = (lambda * ty) >> SHIFT;
+                apply(c.bodyA, invA, -jx, -jy);
+                apply(c.bodyB, invB, jx, jy);
+            }
+
+        m_cache.clear();
+        for (const Contact& c : m_contacts)
+            if (c.massNormal && c.touching)
+                m_cache.push_back(Cached{ PairKey(c.a, c.b), c.nx, c.ny, c.normalImpulse, c.tangentImpulse });
+        std::sort(m_cache.begin(), m_cache.end(), [](const Cached& x, const Cached& y) { return x.key < y.key; });
+    }
+
+    void PhysicsWorld2D::Integrate()
+    {
+        const int64_t dt = timeStep.raw();
+        for (Rigidbody2D* b : m_bodies)
+        {
+            if (!IsMoving(b)) continue;
+            b->m_position.x = fixed16_32(Clamp32(b->m_position.x.raw() + ((b->m_velocity.x.raw() * dt) >> SHIFT)), true);
+            b->m_position.y = fixed16_32(Clamp32(b->m_position.y.raw() + ((b->m_velocity.y.raw() * dt) >> SHIFT)), true);
+        }
+    }
+
+    void PhysicsWorld2D::Correct()
+    {
+        // Projection d'une part de la pénétration au-delà de slop, répartie selon les masses
+        const int64_t allowed = slop.raw(), part = correction.raw();
+        for (const Contact& c : m_contacts)
+        {
+            const int64_t excess = int64_t(c.penetration) - allowed;
+            if (excess <= 0 || !c.massNormal) continue;
+            const int64_t invA = SolverInvMass(c.bodyA), invB = SolverInvMass(c.bodyB);
+            const int64_t amount = (((excess * part) >> SHIFT) * c.massNormal) >> SHIFT;
+            if (invA)
+            {
+                const int64_t d = (amount * invA) >> SHIFT;
+                c.bodyA->m_position.x = fixed16_32(Clamp32(c.bodyA->m_position.x.raw() - ((d * c.nx) >> SHIFT)), true);
+                c.bodyA->m_position.y = fixed16_32(Clamp32(c.bodyA->m_position.y.raw() - ((d * c.ny) >> SHIFT)), true);
+            }
+            if (invB)
+            {
+                const int64_t d = (amount * invB) >> SHIFT;
+                c.bodyB->m_position.x = fixed16_32(Clamp32(c.bodyB->m_position.x.raw() + ((d * c.nx) >> SHIFT)), true);
+                c.bodyB->m_position.y = fixed16_32(Clamp32(c.bodyB->m_position.y.raw() + ((d * c.ny) >> SHIFT)), true);
+            }
+        }
+    }
+
+    void PhysicsWorld2D::Publish()
+    {
+        const int64_t rest = int64_t(sleepSpeed.raw()) * sleepSpeed.raw();
+        for (Rigidbody2D* b : m_bodies)
+        {
+            if (!IsMoving(b)) continue;
+            if (b->isDynamic())
+            {
+                const int64_t vx = b->m_velocity.x.raw(), vy = b->m_velocity.y.raw();
+                if (vx * vx + vy * vy < rest) { if (b->m_restFrames < 0xFFFF) ++b->m_restFrames; }
+                else b->m_restFrames = 0;
+            }
+            const Vector2<fixed12_32> p(fixed12_32(b->m_position.x), fixed12_32(b->m_position.y));
+            if (p == b->m_written) continue;
+            Transform& t = b->gameObject.transform;
+            Vector3<fixed12_32> world = t.position;
+            world.x = p.x;
+            world.y = p.y;
+            t.position = world;
+            b->m_written = p;
+        }
+    }
+
+    void PhysicsWorld2D::Report()
+    {
+        m_current.clear();
+        m_events.clear();
+        for (const Contact& c : m_contacts)
+        {
+            if (!c.touching) continue; // spéculatif : pas encore en contact
+            const uint64_t key = PairKey(c.a, c.b);
+            m_current.push_back(key);
+            if (!std::binary_search(m_touching.begin(), m_touching.end(), key))
+                m_events.push_back(Event{ key, m_shapes[c.a].collider, m_shapes[c.b].collider, c.nx, c.ny, c.px, c.py, true });
+        }
+        // Paires endormies : pas testées ce pas, elles gardent leur état
+        for (uint64_t key : m_links)
+            if (std::binary_search(m_touching.begin(), m_touching.end(), key))
+                m_current.push_back(key);
+        std::sort(m_current.begin(), m_current.end());
+        for (uint64_t key : m_touching)
+            if (!std::binary_search(m_current.begin(), m_current.end(), key))
+                m_events.push_back(Event{ key, m_shapes[uint32_t(key >> 32)].collider, m_shapes[uint32_t(key)].collider, 0, 0, 0, 0, false });
+        m_touching.swap(m_current);
+        if (m_events.empty()) return;
+        std::sort(m_events.begin(), m_events.end(), [](const Event& x, const Event& y) { return x.key < y.key; });
+
+        // Les appels peuvent inscrire ou retirer des colliders : chaque paire est revérifiée
+        for (std::size_t i = 0; i < m_events.size(); ++i)
+        {
+            const Event e = m_events[i];
+            const uint32_t a = uint32_t(e.key >> 32), b = uint32_t(e.key);
+            const auto method = e.enter ? &Component::OnCollisionEnter : &Component::OnCollisionExit;
+            auto alive = [&] { return m_shapes[a].collider == e.a && m_shapes[b].collider == e.b; };
+            if (!alive()) continue;
+            Collision2D toA{ e.a, e.b, m_shapes[b].body,
+                Vector2<fixed16_32>(fixed16_32(e.nx, true), fixed16_32(e.ny, true)),
+                Vector2<fixed16_32>(fixed16_32(e.px, true), fixed16_32(e.py, true)) };
+            e.a->gameObject.CallComponents(method, false, toA);
+            if (!alive()) continue;
+            Collision2D toB{ e.b, e.a, m_shapes[a].body, -toA.normal, toA.point };
+            e.b->gameObject.CallComponents(method, false, toB);
+        }
+    }
+
+    void PhysicsWorld2D::Step()
+    {
+        if (m_bodies.empty() && m_touching.empty()) return;
+        SyncBodies();
+        Broadphase();
+        Islands();
+        Solve();
+        Integrate();
+        Correct();
+        Publish();
+        Report();
+    }
+
+}
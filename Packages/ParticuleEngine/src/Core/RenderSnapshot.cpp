@@ -0,0 +1,214 @@
+#include <Particule/Engine/Core/RenderSnapshot.hpp>
+#include <cstring>
+
+namespace Particule::Engine {
+
+    namespace
+    {
+        constexpr uint32_t MAX_SEQUENCE = (1u << 20) - 1;
+
+        // Couleur repliée sur 8 bits : une collision regroupe moins bien, sans changer le rendu
+        inline uint64_t ColorBits(const Color& color) noexcept
+        {
+            uint32_t raw = color.Raw();
+            raw ^= raw >> 16;
+            return (raw ^ (raw >> 8)) & 0xFF;
+        }
+    }
+
+    uint64_t RenderSnapshot::StateKey(Kind kind, bool tinted, const void* state, const Color& color)
+    {
+        uint64_t id = 0;
+        if (state)
+        {
+            // Identifiants dans l'ordre de première apparition : clé identique d'une exécution à l'autre
+            auto it = m_stateIds.try_emplace(state, static_cast<uint32_t>(m_stateIds.size() + 1)).first;
+            id = it->second & 0xFF;
+        }
+        // Au-delà de MAX_SEQUENCE commandes, les suivantes partagent le dernier ordre et se regroupent par état
+        uint64_t sequence = 0;
+        if (!m_batch)
+        {
+            if (m_sequence < MAX_SEQUENCE) ++m_sequence;
+            sequence = m_sequence;
+        }
+        return m_prefix | sequence << 20 | uint64_t(kind) << 17 | uint64_t(tinted) << 16 | id << 8 | ColorBits(color);
+    }
+
+    void RenderSnapshot::Clear() noexcept
+    {
+        m_commands.clear();
+        m_order.clear();
+        m_stateIds.clear();
+        m_prefix = uint64_t(0x8000) << 40;
+        m_sequence = 0;
+        m_batch = false;
+        m_text.clear();
+        m_custom.clear();
+        m_hasSky = false;
+    }
+
+    void RenderSnapshot::DrawSprite(Sprite& sprite, int x, int y)
+    {
+        // Même convention que Sprite::Draw : largeur/hauteur négatives = miroir
+        const Rect r = sprite.GetRect();
+        DrawTexture(sprite.GetTexture(), x, y, r.w, r.h, Rect{ r.x, r.y, r.w > 0 ? r.w : -r.w, r.h > 0 ? r.h : -r.h });
+    }
+
+    void RenderSnapshot::DrawSprite(Sprite& sprite, int x, int y, int w, int h)
+    {
+        DrawTexture(sprite.GetTexture(), x, y, w, h, sprite.GetRect());
+    }
+
+    void RenderSnapshot::DrawSpriteColor(Sprite& sprite, int x, int y, const Color& color)
+    {
+        DrawSprite(sprite, x, y);
+        Command& c = m_commands.back();
+        c.tinted = true;
+        c.color = color;
+        c.key = StateKey(Kind::Texture, true, c.texture, color);
+    }
+
+    void RenderSnapshot::DrawTexture(Texture* texture, int x, int y, int w, int h, Rect source)
+    {
+        Command& c = m_commands.emplace_back(Kind::Texture);
+        c.texture = texture;
+        c.x = x; c.y = y; c.w = w; c.h = h;
+        c.source = source;
+        c.key = StateKey(Kind::Texture, false, texture, c.color);
+    }
+
+    void RenderSnapshot::DrawText(Font* font, std::string_view text, int x, int y, const Color& color, int size)
+    {
+        Command& c = m_commands.emplace_back(Kind::Text);
+        c.font = font;
+        c.x = x; c.y = y; c.w = size;
+        c.color = color;
+        c.offset = static_cast<uint32_t>(m_text.size());
+        c.length = static_cast<uint32_t>(text.size());
+        c.key = StateKey(Kind::Text, false, font, color);
+        m_text.append(text);
+    }
+
+    void RenderSnapshot::DrawRectFilled(int x, int y, int w, int h, const Color& color)
+    {
+        Command& c = m_commands.emplace_back(Kind::RectFilled);
+        c.x = x; c.y = y; c.w = w; c.h = h;
+        c.color = color;
+        c.key = StateKey(Kind::RectFilled, false, nullptr, color);
+    }
+
+    void RenderSnapshot::DrawRectOutline(int x, int y, int w, int h, const Color& color)
+    {
+        Command& c = m_commands.emplace_back(Kind::RectOutline);
+        c.x = x; c.y = y; c.w = w; c.h = h;
+        c.color = color;
+        c.key = StateKey(Kind::RectOutline, false, nullptr, color);
+    }
+
+    void RenderSnapshot::DrawLine(int x1, int y1, int x2, int y2, const Color& color)
+    {
+        Command& c = m_commands.emplace_back(Kind::Line);
+        c.x = x1; c.y = y1; c.w = x2; c.h = y2;
+        c.color = color;
+        c.key = StateKey(Kind::Line, false, nullptr, color);
+    }
+
+    void RenderSnapshot::DrawPixel(int x, int y, const Color& color)
+    {
+        Command& c = m_commands.emplace_back(Kind::Pixel);
+        c.x = x; c.y = y;
+        c.color = color;
+        c.key = StateKey(Kind::Pixel, false, nullptr, color);
+    }
+
+    void RenderSnapshot::DrawCustom(std::function<void()> draw)
+    {
+        Command& c = m_commands.emplace_back(Kind::Custom);
+        c.offset = static_cast<uint32_t>(m_custom.size());
+        c.key = StateKey(Kind::Custom, false, nullptr, c.color);
+        m_custom.push_back(std::move(draw));
+    }
+
+    void RenderSnapshot::Sort()
+    {
+        const std::size_t n = m_commands.size();
+        m_order.resize(n);
+        if (n < 2)
+        {
+            if (n) m_order[0] = SortEntry{ m_commands[0].key, 0 };
+            return;
+        }
+        // Histogrammes des 8 octets en un seul parcours
+        uint32_t counts[8][256];
+        std::memset(counts, 0, sizeof(counts));
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const uint64_t key = m_commands[i].key;
+            m_order[i] = SortEntry{ key, static_cast<uint32_t>(i) };
+            for (int b = 0; b < 8; ++b)
+                ++counts[b][(key >> (b * 8)) & 0xFF];
+        }
+        m_sortBuffer.resize(n);
+        SortEntry* src = m_order.data();
+        SortEntry* dst = m_sortBuffer.data();
+        for (int b = 0; b < 8; ++b)
+        {
+            uint32_t* count = counts[b];
+            // Octet identique partout : la passe ne changerait rien
+            if (count[(src[0].key >> (b * 8)) & 0xFF] == n) continue;
+            uint32_t offset = 0;
+            for (int v = 0; v < 256; ++v)
+            {
+                const uint32_t c = count[v];
+                count[v] = offset;
+                offset += c;
+            }
+            for (std::size_t i = 0; i < n; ++i)
+                dst[count[(src[i].key >> (b * 8)) & 0xFF]++] = src[i];
+            std::swap(src, dst);
+        }
+        if (src != m_order.data())
+            m_order.swap(m_sortBuffer);
+    }
+
+    void RenderSnapshot::Execute()
+    {
+        if (m_hasSky) m_sky.Draw();
+        std::string text;
+        const bool sorted = m_order.size() == m_commands.size();
+        for (std::size_t i = 0; i < m_commands.size(); ++i)
+        {
+            const Command& c = m_commands[sorted ? m_order[i].index : i];
+            switch (c.kind)
+            {
+                case Kind::Texture:
+                    if (!c.texture) break;
+                    if (c.tinted) c.texture->DrawSubSizeColor(c.x, c.y, c.w, c.h, c.source, c.color);
+                    else c.texture->DrawSubSize(c.x, c.y, c.w, c.h, c.source);
+                    break;
+                case Kind::Text:
+                    if (!c.font) break;
+                    text.assign(m_text, c.offset, c.length);
+                    c.font->DrawText(text, c.x, c.y, c.color, c.w);
+                    break;
+                case Kind::RectFilled:
+                    Particule::Core::DrawRectFilled(c.x, c.y, c.w, c.h, c.color);
+                    break;
+                case Kind::RectOutline:
+                    Particule::Core::DrawRectOutline(c.x, c.y, c.w, c.h, c.color);
+                    break;
+                case Kind::Line:
+                    Particule::Core::DrawLine(c.x, c.y, c.w, c.h, c.color);
+                    break;
+                case Kind::Pixel:
+                    Particule::Core::DrawPixel(c.x, c.y, c.color);
+                    break;
+                case Kind::Custom:
+                    m_custom[c.offset]();
+                    break;
+            }
+        }
+    }
+
+}
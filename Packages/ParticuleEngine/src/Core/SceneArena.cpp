@@ -0,0 +1,83 @@
+#include <Particule/Engine/Core/SceneArena.hpp>
+#include <new>
+#include <cstdlib>
+
+namespace Particule::Engine {
+
+    // En-tête d'un bloc : taille arrondie à GRAIN, en-tête compris
+    static inline std::size_t& BlockSize(void* p) noexcept
+    {
+        return *reinterpret_cast<std::size_t*>(static_cast<unsigned char*>(p) - SceneArena::GRAIN);
+    }
+
+    unsigned char* SceneArena::Grow(std::size_t bytes)
+    {
+        const std::size_t header = (sizeof(Chunk) + GRAIN - 1) / GRAIN * GRAIN;
+        const std::size_t size = bytes > m_chunkSize ? bytes : m_chunkSize;
+        Chunk* chunk = static_cast<Chunk*>(std::malloc(header + size));
+        if (!chunk) throw std::bad_alloc();
+        chunk->next = m_chunks;
+        chunk->size = header + size;
+        m_chunks = chunk;
+        m_reserved += header + size;
+        unsigned char* data = reinterpret_cast<unsigned char*>(chunk) + header;
+        // Un bloc surdimensionné ne remplace pas le bloc courant
+        if (bytes > m_chunkSize)
+            return data;
+        m_cursor = data;
+        m_end = data + size;
+        return nullptr;
+    }
+
+    void* SceneArena::Allocate(std::size_t size, std::size_t align)
+    {
+        if (!m_chunkSize || align > GRAIN) return nullptr;
+        const std::size_t bytes = (size + GRAIN - 1) / GRAIN * GRAIN + GRAIN;
+        unsigned char* block = nullptr;
+        const std::size_t cls = bytes / GRAIN - 1;
+        if (cls < CLASSES && m_free[cls])
+        {
+            block = static_cast<unsigned char*>(m_free[cls]);
+            m_free[cls] = *reinterpret_cast<void**>(block + GRAIN);
+        }
+        else if (static_cast<std::size_t>(m_end - m_cursor) >= bytes)
+        {
+            block = m_cursor;
+            m_cursor += bytes;
+        }
+        else if (!(block = Grow(bytes)))
+        {
+            block = m_cursor;
+            m_cursor += bytes;
+        }
+        m_used += bytes;
+        void* p = block + GRAIN;
+        BlockSize(p) = bytes;
+        return p;
+    }
+
+    void SceneArena::Deallocate(void* p) noexcept
+    {
+        if (!p) return;
+        const std::size_t bytes = BlockSize(p);
+        m_used -= bytes;
+        const std::size_t cls = bytes / GRAIN - 1;
+        if (cls >= CLASSES) return; // gros bloc : rendu au Release
+        *static_cast<void**>(p) = m_free[cls];
+        m_free[cls] = static_cast<unsigned char*>(p) - GRAIN;
+    }
+
+    void SceneArena::Release() noexcept
+    {
+        while (m_chunks)
+        {
+            Chunk* next = m_chunks->next;
+            std::free(m_chunks);
+            m_chunks = next;
+        }
+        m_cursor = m_end = nullptr;
+        m_used = m_reserved = 0;
+        for (void*& f : m_free) f = nullptr;
+    }
+
+}
@@ -0,0 +1,418 @@
+#include <Particule/Engine/Core/SpatialHash.hpp>
+#include <Particule/Engine/Core/Component.hpp>
+#include <algorithm>
+#include <bit>
+
+namespace Particule::Engine {
+
+    namespace
+    {
+        constexpr int64_t UNIT = int64_t(1) << 24; // longueur des directions de rayon : 12 bits ne suffisent pas aux longues distances
+        constexpr int64_t INF = std::numeric_limits<int64_t>::max();
+
+        inline fixed12_32 FromRaw(int64_t v) noexcept
+        {
+            return fixed12_32(static_cast<int32_t>(std::clamp<int64_t>(v, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max())), true);
+        }
+
+        uint64_t ISqrt(uint64_t v) noexcept
+        {
+            uint64_t result = 0;
+            uint64_t bit = uint64_t(1) << 62;
+            while (bit > v) bit >>= 2;
+            while (bit)
+            {
+                if (v >= result + bit)
+                {
+                    v -= result + bit;
+                    result = (result >> 1) + bit;
+                }
+                else
+                    result >>= 1;
+                bit >>= 2;
+            }
+            return result;
+        }
+
+        // Entrée du rayon o + u.t / UNIT (|u| = UNIT) dans b pour t dans [0, maxT], en brut
+        bool Slab(int64_t ox, int64_t oy, int64_t ux, int64_t uy, const Bounds2D& b, int64_t maxT, int64_t& tEnter) noexcept
+        {
+            int64_t t0 = 0, t1 = maxT;
+            const int64_t o[2] = { ox, oy };
+            const int64_t u[2] = { ux, uy };
+            const int64_t lo[2] = { b.min.x.raw(), b.min.y.raw() };
+            const int64_t hi[2] = { b.max.x.raw(), b.max.y.raw() };
+            for (int a = 0; a < 2; ++a)
+            {
+                if (u[a] == 0)
+                {
+                    if (o[a] < lo[a] || o[a] > hi[a]) return false;
+                    continue;
+                }
+                int64_t ta = (lo[a] - o[a]) * UNIT / u[a];
+                int64_t tb = (hi[a] - o[a]) * UNIT / u[a];
+                if (ta > tb) std::swap(ta, tb);
+                t0 = std::max(t0, ta);
+                t1 = std::min(t1, tb);
+                if (t0 > t1) return false;
+            }
+            tEnter = t0;
+            return true;
+        }
+
+        // Point de b le plus proche de (px, py) et carré de la distance, en brut
+        int64_t ClosestPoint(const Bounds2D& b, int64_t px, int64_t py, int64_t& cx, int64_t& cy) noexcept
+        {
+            cx = std::clamp<int64_t>(px, b.min.x.raw(), b.max.x.raw());
+            cy = std::clamp<int64_t>(py, b.min.y.raw(), b.max.y.raw());
+            const int64_t dx = px - cx, dy = py - cy;
+            return dx * dx + dy * dy;
+        }
+    }
+
+    void SpatialHash::Configure(int cellShift, std::size_t bucketCount)
+    {
+        m_cellShift = std::clamp(cellShift, 0, 18);
+        m_buckets.assign(std::bit_ceil(std::max<std::size_t>(bucketCount, 1)), {});
+        m_minX = m_minY = 0;
+        m_maxX = m_maxY = -1;
+        for (uint32_t id = 0; id < m_proxies.size(); ++id)
+            if (m_proxies[id].owner)
+                Link(id);
+    }
+
+    void SpatialHash::ComputeWorld(Proxy& p) const
+    {
+        Transform& t = p.owner->gameObject.transform;
+        const Vector3<fixed12_32> pos = t.position;
+        const Vector3<fixed12_32> s = t.scale;
+        fixed12_32 x0 = pos.x + p.local.min.x * s.x, x1 = pos.x + p.local.max.x * s.x;
+        fixed12_32 y0 = pos.y + p.local.min.y * s.y, y1 = pos.y + p.local.max.y * s.y;
+        if (x1 < x0) std::swap(x0, x1); // échelle négative : miroir
+        if (y1 < y0) std::swap(y0, y1);
+        p.world = Bounds2D{ { x0, y0 }, { x1, y1 } };
+        p.stamp = t.worldStamp();
+    }
+
+    void SpatialHash::Link(uint32_t id)
+    {
+        Proxy& p = m_proxies[id];
+        p.cx0 = Cell(p.world.min.x); p.cy0 = Cell(p.world.min.y);
+        p.cx1 = Cell(p.world.max.x); p.cy1 = Cell(p.world.max.y);
+        if (m_maxX < m_minX)
+        {
+            m_minX = p.cx0; m_minY = p.cy0; m_maxX = p.cx1; m_maxY = p.cy1;
+        }
+        else
+        {
+            m_minX = std::min(m_minX, p.cx0); m_minY = std::min(m_minY, p.cy0);
+            m_maxX = std::max(m_maxX, p.cx1); m_maxY = std::max(m_maxY, p.cy1);
+        }
+        const uint64_t cells = uint64_t(int64_t(p.cx1) - p.cx0 + 1) * uint64_t(int64_t(p.cy1) - p.cy0 + 1);
+        if (cells >= m_buckets.size())
+        {
+            // Boîte plus grande que la table : présente dans tous les seaux
+            for (auto& bucket : m_buckets) bucket.push_back(id);
+            return;
+        }
+        m_scratch.clear();
+        for (int32_t cy = p.cy0; cy <= p.cy1; ++cy)
+            for (int32_t cx = p.cx0; cx <= p.cx1; ++cx)
+                m_scratch.push_back(static_cast<uint32_t>(Bucket(cx, cy)));
+        std::sort(m_scratch.begin(), m_scratch.end());
+        m_scratch.erase(std::unique(m_scratch.begin(), m_scratch.end()), m_scratch.end());
+        for (uint32_t b : m_scratch)
+            m_buckets[b].push_back(id);
+    }
+
+    void SpatialHash::Unlink(uint32_t id) noexcept
+    {
+        const Proxy& p = m_proxies[id];
+        auto erase = [id](std::vector<uint32_t>& bucket) {
+            auto it = std::find(bucket.begin(), bucket.end(), id);
+            if (it == bucket.end()) return;
+            *it = bucket.back();
+            bucket.pop_back();
+        };
+        const uint64_t cells = uint64_t(int64_t(p.cx1) - p.cx0 + 1) * uint64_t(int64_t(p.cy1) - p.cy0 + 1);
+        if (cells >= m_buckets.size())
+        {
+            for (auto& bucket : m_buckets) erase(bucket);
+            return;
+        }
+        // Un seau partagé par deux cellules est visité deux fois : le second passage ne trouve plus rien
+        for (int32_t cy = p.cy0; cy <= p.cy1; ++cy)
+            for (int32_t cx = p.cx0; cx <= p.cx1; ++cx)
+                erase(m_buckets[Bucket(cx, cy)]);
+    }
+
+    void SpatialHash::Move(uint32_t id)
+    {
+        Proxy& p = m_proxies[id];
+        ComputeWorld(p);
+        if (Cell(p.world.min.x) == p.cx0 && Cell(p.world.min.y) == p.cy0
+            && Cell(p.world.max.x) == p.cx1 && Cell(p.world.max.y) == p.cy1)
+            return; // mêmes cellules : seule la boîte change
+        Unlink(id);
+        Link(id);
+    }
+
+    void SpatialHash::Add(SpatialProxy& proxy, Component& owner, const Bounds2D& local, bool rendering)
+    {
+        uint32_t id;
+        if (!m_free.empty())
+        {
+            id = m_free.back();
+            m_free.pop_back();
+        }
+        else
+        {
+            id = static_cast<uint32_t>(m_proxies.size());
+            m_proxies.emplace_back();
+        }
+        Proxy& p = m_proxies[id];
+        p.owner = &owner;
+        p.handle = &proxy;
+        p.local = local;
+        p.rendering = rendering;
+        ComputeWorld(p);
+        Link(id);
+        if (rendering)
+            ++owner.gameObject.m_renderProxies;
+        if (!owner.gameObject.isStatic)
+        {
+            p.dynamicIndex = static_cast<int32_t>(m_dynamic.size());
+            m_dynamic.push_back(id);
+        }
+        proxy.grid = this;
+        proxy.id = id;
+    }
+
+    void SpatialHash::Remove(uint32_t id) noexcept
+    {
+        if (id >= m_proxies.size() || !m_proxies[id].owner) return;
+        Unlink(id);
+        Proxy& p = m_proxies[id];
+        if (p.dynamicIndex >= 0)
+        {
+            const uint32_t last = m_dynamic.back();
+            m_dynamic[p.dynamicIndex] = last;
+            m_proxies[last].dynamicIndex = p.dynamicIndex;
+            m_dynamic.pop_back();
+        }
+        if (p.handle)
+            *p.handle = SpatialProxy{};
+        if (p.rendering)
+            --p.owner->gameObject.m_renderProxies;
+        p = Proxy{};
+        m_free.push_back(id);
+    }
+
+    void SpatialHash::SetBounds(uint32_t id, const Bounds2D& local)
+    {
+        m_proxies[id].local = local;
+        Move(id);
+    }
+
+    void SpatialHash::Refresh(uint32_t id)
+    {
+        Move(id);
+    }
+
+    void SpatialHash::Update()
+    {
+        for (uint32_t id : m_dynamic)
+        {
+            const Proxy& p = m_proxies[id];
+            if (p.owner->gameObject.transform.worldStamp() != p.stamp)
+                Move(id);
+        }
+    }
+
+    void SpatialHash::MoveProxies(GameObject& go, SpatialHash& dst)
+    {
+        if (&dst == this) return;
+        for (uint32_t id = 0; id < m_proxies.size(); ++id)
+        {
+            const Proxy& p = m_proxies[id];
+            if (!p.owner || &p.owner->gameObject != &go) continue;
+            Component& owner = *p.owner;
+            SpatialProxy& handle = *p.handle;
+            const Bounds2D local = p.local;
+            const bool rendering = p.rendering;
+            Remove(id);
+            dst.Add(handle, owner, local, rendering);
+        }
+    }
+
+    template <typename F>
+    void SpatialHash::ForEachInCell(int32_t cx, int32_t cy, uint32_t layerMask, F&& f) const
+    {
+        for (uint32_t id : m_buckets[Bucket(cx, cy)])
+        {
+            const Proxy& p = m_proxies[id];
+            if (cx < p.cx0 || cx > p.cx1 || cy < p.cy0 || cy > p.cy1) continue; // autre cellule du même seau
+            if (!(layerMask & LayerBit(p.owner->gameObject.layer))) continue;
+            f(p);
+        }
+    }
+
+    std::size_t SpatialHash::OverlapBox(const Bounds2D& box, std::span<Component*> out, uint32_t layerMask) const
+    {
+        if (out.empty() || m_maxX < m_minX) return 0;
+        const int32_t x0 = std::max(Cell(box.min.x), m_minX), x1 = std::min(Cell(box.max.x), m_maxX);
+        const int32_t y0 = std::max(Cell(box.min.y), m_minY), y1 = std::min(Cell(box.max.y), m_maxY);
+        std::size_t count = 0;
+        for (int32_t cy = y0; cy <= y1; ++cy)
+            for (int32_t cx = x0; cx <= x1; ++cx)
+            {
+                ForEachInCell(cx, cy, layerMask, [&](const Proxy& p) {
+                    // Rapporté dans la première cellule commune à la requête et au proxy : une seule fois
+                    if (std::max(x0, p.cx0) != cx || std::max(y0, p.cy0) != cy) return;
+                    if (count < out.size() && p.world.Overlaps(box))
+                        out[count++] = p.owner;
+                });
+                if (count == out.size()) return count;
+            }
+        return count;
+    }
+
+    std::size_t SpatialHash::OverlapCircle(const Vector2<fixed12_32>& center, fixed12_32 radius, std::span<Component*> out, uint32_t layerMask) const
+    {
+        if (out.empty() || m_maxX < m_minX) return 0;
+        const Bounds2D box = Bounds2D::FromCenter(center, { radius, radius });
+        const int32_t x0 = std::max(Cell(box.min.x), m_minX), x1 = std::min(Cell(box.max.x), m_maxX);
+        const int32_t y0 = std::max(Cell(box.min.y), m_minY), y1 = std::min(Cell(box.max.y), m_maxY);
+        const int64_t r2 = int64_t(radius.raw()) * radius.raw();
+        std::size_t count = 0;
+        for (int32_t cy = y0; cy <= y1; ++cy)
+            for (int32_t cx = x0; cx <= x1; ++cx)
+            {
+                ForEachInCell(cx, cy, layerMask, [&](const Proxy& p) {
+                    if (std::max(x0, p.cx0) != cx || std::max(y0, p.cy0) != cy) return;
+                    int64_t qx, qy;
+                    if (count < out.size() && ClosestPoint(p.world, center.x.raw(), center.y.raw(), qx, qy) <= r2)
+                        out[count++] = p.owner;
+                });
+                if (count == out.size()) return count;
+            }
+        return count;
+    }
+
+    bool SpatialHash::Raycast(const Vector2<fixed12_32>& origin, const Vector2<fixed12_32>& direction, SpatialHit& hit,
+                              fixed12_32 maxDistance, uint32_t layerMask) const
+    {
+        if (m_maxX < m_minX || maxDistance < 0) return false;
+        layerMask &= ~LayerBit(Layer::LAYER_IgnoreRaycast);
+        const int64_t dx = direction.x.raw(), dy = direction.y.raw();
+        const int64_t len = static_cast<int64_t>(ISqrt(static_cast<uint64_t>(dx * dx + dy * dy)));
+        if (len == 0) return false;
+        const int64_t ux = dx * UNIT / len, uy = dy * UNIT / len;
+        const int64_t ox = origin.x.raw(), oy = origin.y.raw();
+        const int64_t maxT = maxDistance.raw();
+
+        // Rayon ramené à la zone occupée : pas de cellules vides à parcourir avant d'y entrer
+        const int shift = 12 + m_cellShift;
+        const Bounds2D occupied{ { FromRaw(int64_t(m_minX) << shift), FromRaw(int64_t(m_minY) << shift) },
+                                 { FromRaw(((int64_t(m_maxX) + 1) << shift) - 1), FromRaw(((int64_t(m_maxY) + 1) << shift) - 1) } };
+        int64_t tStart;
+        if (!Slab(ox, oy, ux, uy, occupied, maxT, tStart)) return false;
+        const int64_t sx = ox + ux * tStart / UNIT, sy = oy + uy * tStart / UNIT;
+        int32_t cx = std::clamp(static_cast<int32_t>(sx >> shift), m_minX, m_maxX);
+        int32_t cy = std::clamp(static_cast<int32_t>(sy >> shift), m_minY, m_maxY);
+
+        // DDA : t (brut) de sortie de la cellule courante sur chaque axe
+        const int stepX = ux > 0 ? 1 : (ux < 0 ? -1 : 0);
+        const int stepY = uy > 0 ? 1 : (uy < 0 ? -1 : 0);
+        const int64_t cell = int64_t(1) << shift;
+        int64_t tMaxX = stepX > 0 ? ((int64_t(cx + 1) << shift) - ox) * UNIT / ux
+                      : stepX < 0 ? ((int64_t(cx) << shift) - ox) * UNIT / ux : INF;
+        int64_t tMaxY = stepY > 0 ? ((int64_t(cy + 1) << shift) - oy) * UNIT / uy
+                      : stepY < 0 ? ((int64_t(cy) << shift) - oy) * UNIT / uy : INF;
+        const int64_t tDeltaX = stepX ? cell * UNIT / (ux < 0 ? -ux : ux) : INF;
+        const int64_t tDeltaY = stepY ? cell * UNIT / (uy < 0 ? -uy : uy) : INF;
+
+        int64_t best = INF;
+        const Proxy* bestProxy = nullptr;
+        while (cx >= m_minX && cx <= m_maxX && cy >= m_minY && cy <= m_maxY)
+        {
+            ForEachInCell(cx, cy, layerMask, [&](const Proxy& p) {
+                int64_t t;
+                if (Slab(ox, oy, ux, uy, p.world, maxT, t) && t < best)
+                {
+                    best = t;
+                    bestProxy = &p;
+                }
+            });
+            const int64_t tExit = std::min(tMaxX, tMaxY);
+            // Un contact avant la sortie de la cellule ne peut plus être battu par les cellules suivantes
+            if (best <= tExit || tExit > maxT) break;
+            if (tMaxX < tMaxY) { cx += stepX; tMaxX += tDeltaX; }
+            else               { cy += stepY; tMaxY += tDeltaY; }
+        }
+        if (!bestProxy) return false;
+        hit.component = bestProxy->owner;
+        hit.distance = FromRaw(best);
+        hit.point = { FromRaw(ox + ux * best / UNIT), FromRaw(oy + uy * best / UNIT) };
+        return true;
+    }
+
+    std::size_t SpatialHash::Nearest(const Vector2<fixed12_32>& point, std::span<SpatialHit> out,
+                                     fixed12_32 maxDistance, uint32_t layerMask) const
+    {
+        if (out.empty() || m_maxX < m_minX || maxDistance < 0) return 0;
+        const int shift = 12 + m_cellShift;
+        const int64_t px = point.x.raw(), py = point.y.raw();
+        const int64_t maxD2 = int64_t(maxDistance.raw()) * maxDistance.raw();
+        const int32_t pcx = Cell(point.x), pcy = Cell(point.y);
+        // Anneaux de cellules autour de celle du point, jusqu'à couvrir la zone occupée ou maxDistance
+        int64_t rMax = std::max({ int64_t(pcx) - m_minX, int64_t(m_maxX) - pcx, int64_t(pcy) - m_minY, int64_t(m_maxY) - pcy });
+        rMax = std::min(rMax, (int64_t(maxDistance.raw()) >> shift) + 1);
+        std::size_t count = 0;
+
+        auto visit = [&](int32_t cx, int32_t cy) {
+            if (cx < m_minX || cx > m_maxX || cy < m_minY || cy > m_maxY) return;
+            ForEachInCell(cx, cy, layerMask, [&](const Proxy& p) {
+                // Rapporté dans sa cellule la plus proche de celle du point : une seule fois
+                if (std::clamp(pcx, p.cx0, p.cx1) != cx || std::clamp(pcy, p.cy0, p.cy1) != cy) return;
+                int64_t qx, qy;
+                const int64_t d2 = ClosestPoint(p.world, px, py, qx, qy);
+                if (d2 > maxD2) return;
+                const fixed12_32 d = FromRaw(static_cast<int64_t>(ISqrt(static_cast<uint64_t>(d2))));
+                if (count == out.size() && d >= out[count - 1].distance) return;
+                // Insertion triée ; à distance égale, le premier trouvé reste devant
+                std::size_t i = count < out.size() ? count++ : count - 1;
+                for (; i > 0 && out[i - 1].distance > d; --i)
+                    out[i] = out[i - 1];
+                out[i] = SpatialHit{ p.owner, d, { FromRaw(qx), FromRaw(qy) } };
+            });
+        };
+
+        for (int64_t r = 0; r <= rMax; ++r)
+        {
+            const int32_t ri = static_cast<int32_t>(r);
+            if (r == 0)
+                visit(pcx, pcy);
+            else
+            {
+                for (int32_t cx = pcx - ri; cx <= pcx + ri; ++cx)
+                {
+                    visit(cx, pcy - ri);
+                    visit(cx, pcy + ri);
+                }
+                for (int32_t cy = pcy - ri + 1; cy <= pcy + ri - 1; ++cy)
+                {
+                    visit(pcx - ri, cy);
+                    visit(pcx + ri, cy);
+                }
+            }
+            if (count < out.size()) continue;
+            // Distance du point au bord du carré parcouru : au-delà, les anneaux suivants ne peuvent pas faire mieux
+            const int64_t edge = std::min({ px - (int64_t(pcx - ri) << shift), (int64_t(pcx + ri + 1) << shift) - px,
+                                            py - (int64_t(pcy - ri) << shift), (int64_t(pcy + ri + 1) << shift) - py });
+            if (out[count - 1].distance.raw() <= edge) break;
+        }
+        return count;
+    }
+
+}
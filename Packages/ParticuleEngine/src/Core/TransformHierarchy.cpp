@@ -0,0 +1,85 @@
+#include <Particule/Engine/Core/TransformHierarchy.hpp>
+#include <Particule/Engine/Core/Transform.hpp>
+
+namespace Particule::Engine {
+
+    TransformHierarchy::~TransformHierarchy()
+    {
+        for (Transform* t : m_order)
+        {
+            t->m_hierarchy = nullptr;
+            t->m_hierarchyIndex = -1;
+        }
+    }
+
+    void TransformHierarchy::Add(Transform* t)
+    {
+        if (!t || t->m_hierarchy == this) return;
+        if (t->m_hierarchy) t->m_hierarchy->Remove(t);
+        t->m_hierarchy = this;
+        t->m_hierarchyIndex = static_cast<int32_t>(m_order.size());
+        m_order.push_back(t);
+        t->m_worldDirty = false;
+        t->markWorldDirty();
+        MarkStructureDirty();
+    }
+
+    void TransformHierarchy::Remove(Transform* t) noexcept
+    {
+        if (!t || t->m_hierarchy != this) return;
+        const int32_t index = t->m_hierarchyIndex;
+        // Retrait par échange avec le dernier : l'ordre est reconstruit à la prochaine passe
+        Transform* last = m_order.back();
+        m_order[index] = last;
+        last->m_hierarchyIndex = index;
+        m_order.pop_back();
+        t->m_hierarchy = nullptr;
+        t->m_hierarchyIndex = -1;
+        MarkStructureDirty();
+    }
+
+    void TransformHierarchy::Rebuild()
+    {
+        std::vector<Transform*> order;
+        order.reserve(m_order.size());
+        // Racines : sans parent, ou parent hors de cette hiérarchie (l'ordre relatif des racines est conservé)
+        for (Transform* t : m_order)
+        {
+            if (t->m_parent && t->m_parent->m_hierarchy == this) continue;
+            m_stack.push_back(t);
+            while (!m_stack.empty())
+            {
+                Transform* node = m_stack.back();
+                m_stack.pop_back();
+                order.push_back(node);
+                // Empilés à l'envers pour sortir dans l'ordre des enfants
+                auto& children = node->m_children;
+                for (std::size_t c = children.size(); c-- > 0; )
+                    if (children[c]->m_hierarchy == this)
+                        m_stack.push_back(children[c]);
+            }
+        }
+        m_order.swap(order);
+        for (std::size_t i = 0; i < m_order.size(); ++i)
+            m_order[i]->m_hierarchyIndex = static_cast<int32_t>(i);
+        m_structureDirty = false;
+    }
+
+    void TransformHierarchy::UpdateWorld()
+    {
+        if (m_structureDirty) Rebuild();
+        if (!worldDirty()) return;
+        m_worldDirty.store(false, std::memory_order_relaxed);
+        for (Transform* t : m_order)
+        {
+            const Transform* parent = t->m_parent;
+            // Parent hors hiérarchie : mise à jour paresseuse classique
+            if (parent && parent->m_hierarchy != this)
+                parent->ensureWorldUpToDate();
+            // Parent recalculé sans marquer ses enfants : écriture pendant la phase parallèle
+            if (t->m_worldDirty || (parent && parent->m_worldStamp != t->m_parentStamp))
+                t->refreshWorld();
+        }
+    }
+
+}
@@ -6,75 +6,209 @@ namespace Particule::Engine {
 
     Scene::~Scene() noexcept
     {
-        // unique_ptr cleans up automatically
+        // unique_ptr runs the destructors; arena_ (last member destroyed) then frees its chunks at once
+        prefabPools_.clear();
         toRemove_.clear();
         gameObjects_.clear();
     }
 
-    void Scene::ToInitialize(GameObject* go) noexcept
+    ComponentPools* GetComponentPools(Scene* scene) noexcept
     {
-        SceneManager::sceneManager->to_initialize_.insert(go);
+        return scene ? &scene->pools_ : nullptr;
     }
 
-    bool Scene::IsNotInitialized(GameObject* go) const noexcept
+    SceneArena* GetSceneArena(Scene* scene) noexcept
     {
-        //return true if the game object is in to_initialize_
-        return SceneManager::sceneManager->to_initialize_.find(go) != SceneManager::sceneManager->to_initialize_.end();
+        return scene && scene->arena_.enabled() ? &scene->arena_ : nullptr;
+    }
+
+    void Scene::ToInitialize(GameObject* go)
+    {
+        if (go->m_state != GameObjectState::Alive) return;
+        auto& pending = SceneManager::sceneManager->to_initialize_;
+        go->m_state = GameObjectState::PendingInit;
+        go->m_initIndex = static_cast<int32_t>(pending.size());
+        pending.push_back(go);
+    }
+
+    void Scene::RefreshHooks(Component* component)
+    {
+        GameObject* go = &component->gameObject;
+        const bool live = isLoaded && go->scene == this && !IsNotInitialized(go)
+                       && !component->m_destroyed && component->enabled() && go->activeInHierarchy();
+        if (live) hooks_.Add(component);
+        else      hooks_.Remove(component);
+    }
+
+    void Scene::RefreshHooks(GameObject* go)
+    {
+        for (auto& up : go->components)
+            RefreshHooks(up.get());
+    }
+
+    void Scene::RefreshAllHooks()
+    {
+        for (auto& up : gameObjects_)
+            RefreshHooks(up.get());
     }
 
     void Scene::DrawSky() noexcept
     {
-        Window* window = Window::GetCurrentWindow();
-        if (skybox.top.A() == 0 && skybox.bottom.A() == 0)
-            return;
-        if (skybox.top == skybox.bottom)
-            window->Clear(skybox.top);
-        else
-        {
-            int heightInt = window->Height();
-            if (skybox.height != heightInt)
-                skybox.CalculateGradient(heightInt);
+        skybox.Draw();
+    }
 
-            fixed12_32 rgb[3] = {skybox.rgb_start[0], skybox.rgb_start[1], skybox.rgb_start[2]};
-            for (int y = 0; y < heightInt; y++)
-            {
-                Color color(static_cast<int>(rgb[0]), static_cast<int>(rgb[1]), static_cast<int>(rgb[2]), 255);
-                DrawHLine(y, color);
-                rgb[0] += skybox.rgbStep[0];
-                rgb[1] += skybox.rgbStep[1];
-                rgb[2] += skybox.rgbStep[2];
-            }
+    bool Scene::Owns_(const GameObject* go) const noexcept
+    {
+        const int32_t i = go->m_sceneIndex;
+        return i >= 0 && static_cast<size_t>(i) < gameObjects_.size() && gameObjects_[i].get() == go;
+    }
+
+    void Scene::Detach_(GameObject* go) noexcept
+    {
+        // Swap-and-pop: the last object takes the freed slot
+        const int32_t i = go->m_sceneIndex;
+        if (static_cast<size_t>(i) + 1 != gameObjects_.size()) {
+            std::swap(gameObjects_[i], gameObjects_.back());
+            gameObjects_[i]->m_sceneIndex = i;
         }
+        (void)gameObjects_.back().release(); // ownership handed back to the caller
+        gameObjects_.pop_back();
+        go->m_sceneIndex = -1;
     }
 
     GameObject& Scene::AddGameObject(std::unique_ptr<GameObject> go)
     {
         if (!go) throw std::invalid_argument("AddGameObject: null unique_ptr");
+        return Adopt_(GameObjectPtr(go.release()));
+    }
+
+    GameObject& Scene::Adopt_(GameObjectPtr go)
+    {
         GameObject* raw = go.get();
         // Ensure the back-reference is correct
         raw->scene = this;
         // Only push if not already owned by this scene
-        if (find_uptr_(raw) == gameObjects_.end())
+        if (Owns_(raw)) {
+            (void)go.release(); // already owned: do not delete it twice
+        } else {
+            raw->m_sceneIndex = static_cast<int32_t>(gameObjects_.size());
             gameObjects_.push_back(std::move(go));
+        }
+        transforms_.Add(&raw->transform);
+        RefreshHooks(raw);
         return *raw;
     }
 
     GameObject& Scene::AddGameObject(GameObject* go_raw)
     {
         if (!go_raw) throw std::invalid_argument("AddGameObject: null raw pointer");
-        // Ensure the back-reference is correct
-        if (go_raw->scene != this) go_raw->scene = this;
-        // Adopt ownership only if not already present in this scene
-        if (find_uptr_(go_raw) == gameObjects_.end())
-            gameObjects_.emplace_back(go_raw);
-        return *go_raw;
+        return Adopt_(GameObjectPtr(go_raw));
     }
 
     void Scene::RemoveGameObject(GameObject* go) noexcept
     {
-        if (!go || go->scene != this) return;
+        if (!go || go->scene != this || go->m_state == GameObjectState::PendingDestroy) return;
+        if (go->m_state == GameObjectState::PendingInit && SceneManager::sceneManager)
+            SceneManager::sceneManager->to_initialize_[go->m_initIndex] = nullptr;
+        if (go->m_pooled) {
+            auto it = prefabPools_.find(go->m_prefab);
+            if (it != prefabPools_.end()) {
+                auto& free = it->second;
+                auto slot = std::find(free.begin(), free.end(), go);
+                if (slot != free.end()) free.erase(slot);
+            }
+            go->m_pooled = false;
+        }
+        go->m_state = GameObjectState::PendingDestroy;
+        go->m_initIndex = -1;
         toRemove_.push_back(go);
-        SceneManager::sceneManager->to_initialize_.erase(go);
+    }
+
+    GameObject* Scene::Spawn_(const Prefab& prefab, const Vector3<fixed12_32>* position)
+    {
+        auto it = prefabPools_.find(&prefab);
+        if (it != prefabPools_.end() && !it->second.empty()) {
+            GameObject* go = it->second.back();
+            it->second.pop_back();
+            go->m_pooled = false;
+            prefab.Respawn(*go);
+            if (position) go->transform.localPosition = *position;
+            go->SetActive(true);
+            return go;
+        }
+        GameObject* go = NewInstance_(prefab);
+        if (position) go->transform.localPosition = *position;
+        return go;
+    }
+
+    GameObject* Scene::NewInstance_(const Prefab& prefab)
+    {
+        GameObject* go = EmplaceGameObject<GameObject>(prefab.name);
+        go->m_prefab = &prefab;
+        prefab.Build(*go);
+        return go;
+    }
+
+    GameObject* Scene::Instantiate(const Prefab& prefab)
+    {
+        return Spawn_(prefab, nullptr);
+    }
+
+    GameObject* Scene::Instantiate(const Prefab& prefab, const Vector3<fixed12_32>& position)
+    {
+        return Spawn_(prefab, &position);
+    }
+
+    void Scene::Despawn(GameObject* go)
+    {
+        if (!go || go->scene != this || go->m_pooled || go->m_state == GameObjectState::PendingDestroy) return;
+        const Prefab* prefab = go->m_prefab;
+        // Never initialized yet: nothing worth keeping
+        if (!prefab || go->m_state == GameObjectState::PendingInit) { RemoveGameObject(go); return; }
+        auto& free = prefabPools_[prefab];
+        if (free.size() >= prefab->poolCapacity) { RemoveGameObject(go); return; }
+        go->SetActive(false);
+        go->transform.SetParent(nullptr, false);
+        go->m_pooled = true;
+        free.push_back(go);
+    }
+
+    void Scene::Prewarm(const Prefab& prefab, size_t count)
+    {
+        auto& free = prefabPools_[&prefab];
+        free.reserve(prefab.poolCapacity);
+        for (size_t i = 0; i < count && free.size() < prefab.poolCapacity; ++i) {
+            GameObject* go = NewInstance_(prefab);
+            go->m_pooled = true;
+            free.push_back(go);
+        }
+    }
+
+    size_t Scene::PooledCount(const Prefab& prefab) const noexcept
+    {
+        auto it = prefabPools_.find(&prefab);
+        return it != prefabPools_.end() ? it->second.size() : 0;
+    }
+
+    void Scene::ParkPooled_(GameObject* go)
+    {
+        if (go->m_pooled && go->activeSelf())
+            go->SetActive(false);
+    }
+
+    void Scene::ParkAllPooled_()
+    {
+        for (auto& [prefab, free] : prefabPools_)
+            for (GameObject* go : free)
+                ParkPooled_(go);
+    }
+
+    void Scene::RemoveComponent(Component* component)
+    {
+        if (!component || component->m_destroyed || component->gameObject.scene != this) return;
+        component->m_destroyed = true;
+        hooks_.Remove(component);
+        componentsToRemove_.push_back(component);
     }
 
     GameObject* Scene::FindGameObject(std::string_view nm) const noexcept
@@ -86,39 +220,79 @@ namespace Particule::Engine {
         return nullptr;
     }
 
+    bool Scene::CanMove_(const GameObject* go) const noexcept
+    {
+        if (!go || go->scene != this || !Owns_(go)) return false;
+        if (go->m_state == GameObjectState::PendingDestroy) return false; // already scheduled here
+        if (go->m_pooled || go->m_arena) return false; // belongs to this scene's prefab pool or arena
+        for (auto& c : go->components)
+            if (c->isPooled() || c->m_arena) return false;
+        return true;
+    }
+
     bool Scene::MoveGameObjectTo(Scene& dst, GameObject* go) noexcept
     {
-        if (!go || go->scene != this) return false;
-        auto it = find_uptr_(go);
-        if (it == gameObjects_.end()) return false; // not found (shouldn’t happen)
+        // Descendants owned by this scene go too, so none is left with its parent in another scene
+        std::vector<GameObject*> subtree{ go };
+        for (size_t i = 0; i < subtree.size(); ++i) {
+            if (!CanMove_(subtree[i])) return false;
+            for (Transform* child : subtree[i]->transform.children())
+                if (child->gameObject.scene == this)
+                    subtree.push_back(&child->gameObject);
+        }
+        for (GameObject* moved : subtree)
+            MoveOne_(dst, moved);
+        return true;
+    }
 
+    void Scene::MoveOne_(Scene& dst, GameObject* go) noexcept
+    {
         // Keep raw pointer stable while transferring unique_ptr
-        std::unique_ptr<GameObject> owned = std::move(*it);
-        gameObjects_.erase(it);
+        Detach_(go);
+        GameObjectPtr owned(go);
+        transforms_.Remove(&go->transform);
+        for (auto& c : go->components)
+            hooks_.Remove(c.get());
+        // Pending component removals follow the object
+        auto pending = std::stable_partition(componentsToRemove_.begin(), componentsToRemove_.end(),
+            [&](Component* c){ return &c->gameObject != go; });
+        dst.componentsToRemove_.insert(dst.componentsToRemove_.end(), pending, componentsToRemove_.end());
+        componentsToRemove_.erase(pending, componentsToRemove_.end());
 
         go->scene = &dst;
-        dst.AddGameObject(std::move(owned));
-        return true;
+        dst.Adopt_(std::move(owned));
+        spatial_.MoveProxies(*go, dst.spatial_);
+        physics_.MoveObject(*go, dst.physics_);
     }
 
     void Scene::EndMainLoop()
     {
-        if (toRemove_.empty()) return;
-
-        std::unordered_set<GameObject*> doomed(toRemove_.begin(), toRemove_.end());
-
-        // Destroy owned objects marked for removal
-        // (unique_ptr handles delete when removed from vector)
-        gameObjects_.erase(
-            std::remove_if(gameObjects_.begin(), gameObjects_.end(),
-                [&](const std::unique_ptr<GameObject>& up){
-                    if (!up) return true; // shouldn't happen, but be safe
-                    if (doomed.count(up.get()) == 0) return false;
-                    up->scene = nullptr;
-                    return true; // erase => destroy
-                }),
-            gameObjects_.end());
+        // Components first (their GameObject may be removed below); callbacks may destroy more
+        while (!componentsToRemove_.empty())
+        {
+            std::vector<Component*> pending;
+            pending.swap(componentsToRemove_);
+            for (Component* c : pending)
+            {
+                GameObject* go = &c->gameObject;
+                if (!IsNotInitialized(go))
+                {
+                    if (c->isActiveAndEnabled()) c->OnDisable();
+                    c->OnDestroy();
+                }
+                go->RemoveComponent(c);
+            }
+        }
 
-        toRemove_.clear();
+        // Destroy owned objects marked for removal (O(1) each); a destructor may not schedule more
+        std::vector<GameObject*> doomed;
+        doomed.swap(toRemove_);
+        for (GameObject* go : doomed)
+        {
+            if (!Owns_(go)) continue; // never adopted (shouldn't happen)
+            Detach_(go);
+            go->scene = nullptr;
+            GameObjectDeleter{}(go);
+        }
     }
 }
\ No newline at end of file
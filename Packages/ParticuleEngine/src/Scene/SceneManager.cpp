@@ -8,13 +8,14 @@ namespace Particule::Engine {
 
     SceneManager* SceneManager::sceneManager = nullptr;
 
-    SceneManager::SceneManager() : availableScenes(0), loadedScenes(0), to_load(0), to_unload(0), to_initialize_(0), loading(false)
+    SceneManager::SceneManager() : availableScenes(0), loadedScenes(0), to_load(0), to_unload(0), to_initialize_(0), loading(false), parallelUpdate_(false), front_(0), pipelined_(false), simulating_(false)
     {
         SceneManager::sceneManager = this;
     }
 
     SceneManager::~SceneManager() noexcept
     {
+        WaitSimulation_();
         to_unload.clear();
         to_load.clear();
         loadedScenes.clear();
@@ -97,7 +98,92 @@ namespace Particule::Engine {
         return loadedScenes.front().get();
     }
 
+    void SceneManager::SetPipelined(bool value)
+    {
+        if (value == pipelined_) return;
+        if (value && JobSystem::WorkerCount() == 0) return; // nothing to overlap with
+        if (value && HasImmediateRendering_()) return;       // those components would never be drawn
+        WaitSimulation_();
+        pipelined_ = value;
+        snapshots_[0].Clear();
+        snapshots_[1].Clear();
+    }
+
+    bool SceneManager::HasImmediateRendering_() const noexcept
+    {
+        for (auto& up : loadedScenes)
+            if (up->hooks_.size(ComponentHook::RenderObject) || up->hooks_.size(ComponentHook::RenderImage))
+                return true;
+        return false;
+    }
+
     void SceneManager::MainLoop()
+    {
+        if (!pipelined_) {
+            LoadPending_();
+            InitializePending_();
+            Simulate_();
+            return;
+        }
+        // Frame N finished at the end of the previous Draw: its snapshot becomes the front one
+        WaitSimulation_();
+        front_ ^= 1;
+        if (loading) {
+            // Unloaded assets may be referenced by the front snapshot
+            LoadPending_();
+            snapshots_[front_].Clear();
+        }
+        // Start may create textures or other SDL resources: main thread
+        InitializePending_();
+        if (HasImmediateRendering_()) {
+            SetPipelined(false);
+            Simulate_();
+            return;
+        }
+        if (Camera::main)
+            Camera::main->FitWindow(); // window size is read on the main thread only
+        simulating_ = true;
+        JobSystem::Run(&SceneManager::SimulateJob_, this, 0, 0, &simulation_);
+    }
+
+    void SceneManager::SimulateJob_(void* data, uint32_t begin, uint32_t end)
+    {
+        (void)begin; (void)end;
+        SceneManager* self = static_cast<SceneManager*>(data);
+        self->Simulate_();
+        RenderSnapshot& back = self->snapshots_[self->front_ ^ 1];
+        back.Clear();
+        self->Extract_(back);
+    }
+
+    void SceneManager::WaitSimulation_()
+    {
+        if (!simulating_) return;
+        JobSystem::Wait(simulation_);
+        simulating_ = false;
+    }
+
+    void SceneManager::Extract_(RenderSnapshot& snapshot)
+    {
+        if (Scene* scene = activeScene())
+            snapshot.SetSky(scene->skybox);
+        ExtractVisible_(snapshot, false);
+    }
+
+    void SceneManager::ExtractVisible_(RenderSnapshot& snapshot, bool culled)
+    {
+        if (Camera* camera = Camera::main) {
+            const Bounds2D view = culled ? camera->culledView() : camera->Cull();
+            DispatchHookIf(ComponentHook::Extract,
+                [camera, &view](const Component& c) { return camera->IsVisible(c, view); },
+                &Component::Extract, snapshot);
+        } else {
+            DispatchHook(ComponentHook::Extract, &Component::Extract, snapshot);
+        }
+        snapshot.Sort();
+    }
+
+    void SceneManager::LoadPending_()
     {
         if (loading) {
             // Unload requested
@@ -136,34 +222,97 @@ namespace Particule::Engine {
                     up->CallAllComponents(&Component::Start, false);
                 }
                 up->isLoaded = true;
+                up->RefreshAllHooks();
+                up->ParkAllPooled_();
             }
             to_load.clear();
             loading = false;
         }
+    }
 
-        // Initialize all GameObjects marked for initialization
-        for (GameObject* go : to_initialize_) {
-            if (go) {
+    void SceneManager::InitializePending_()
+    {
+        // Initialize all GameObjects marked for initialization, in creation order
+        // (objects created during Awake/Start are appended and initialized next frame)
+        const size_t initializing = to_initialize_.size();
+        for (size_t i = 0; i < initializing; ++i) {
+            if (GameObject* go = to_initialize_[i]) {
                 go->CallComponents(&Component::Awake, true);
                 go->CallComponents(&Component::OnEnable, false);
                 go->CallComponents(&Component::Start, false);
             }
         }
-        to_initialize_.clear();
+        for (size_t i = 0; i < initializing; ++i) {
+            GameObject* go = to_initialize_[i];
+            if (!go) continue; // removed meanwhile
+            go->m_state = GameObjectState::Alive;
+            go->m_initIndex = -1;
+            if (go->scene) {
+                go->scene->RefreshHooks(go);
+                go->scene->ParkPooled_(go);
+            }
+        }
+        to_initialize_.erase(to_initialize_.begin(), to_initialize_.begin() + initializing);
+        for (size_t i = 0; i < to_initialize_.size(); ++i)
+            if (GameObject* go = to_initialize_[i]) go->m_initIndex = static_cast<int32_t>(i);
+    }
 
-        CallAllComponents(&Component::FixedUpdate, false);
-        CallAllComponents(&Component::Update, false);
+    void SceneManager::Simulate_()
+    {
+        DispatchHook(ComponentHook::FixedUpdate, &Component::FixedUpdate);
+        for (auto& up : loadedScenes)
+            if (up->enabled)
+                up->physics_.Step(); // forces applied in FixedUpdate are integrated now
+        DispatchHook(ComponentHook::Update, &Component::Update);
+        ParallelUpdate_();
         CoroutineManager::instance().update();
-        CallAllComponents(&Component::LateUpdate, false);
+        DispatchHook(ComponentHook::LateUpdate, &Component::LateUpdate);
 
-        for (auto& up : loadedScenes)
+        for (auto& up : loadedScenes) {
             up->EndMainLoop();
+            up->UpdateTransforms();
+            up->spatial_.Update(); // after the transforms: only moved objects are rehashed
+        }
+    }
+
+    void SceneManager::ParallelUpdate_()
+    {
+        bool any = false;
+        for (auto& up : loadedScenes)
+            if (up->enabled && up->hooks_.size(ComponentHook::ParallelUpdate)) { any = true; break; }
+        if (any) {
+            // Every world cache is computed here, then read only: the jobs never refresh a shared parent
+            for (auto& up : loadedScenes)
+                up->UpdateTransforms();
+            commands_.Begin();
+            parallelUpdate_ = true;
+            TransformHierarchy::Freeze(true);
+            for (auto& up : loadedScenes)
+                if (up->enabled)
+                    up->hooks_.DispatchParallel(ComponentHook::ParallelUpdate, &Component::ParallelUpdate, parallelGrain);
+            TransformHierarchy::Freeze(false);
+            parallelUpdate_ = false;
+            // Children of the objects written during the phase were not marked: catch them up before any read
+            for (auto& up : loadedScenes)
+                up->UpdateTransforms();
+        }
+        commands_.Apply();
     }
 
     void SceneManager::Draw()
     {
+        if (pipelined_) {
+            snapshots_[front_].Execute();
+            WaitSimulation_(); // input and time are updated next frame, after the simulation
+            return;
+        }
         if (loadedScenes.empty() || Camera::main == nullptr)
             return;
         Camera::main->Render();
+        // Components that only extract are drawn the same way in both modes
+        RenderSnapshot& snapshot = snapshots_[front_];
+        snapshot.Clear();
+        ExtractVisible_(snapshot, true); // Render has already culled this frame
+        snapshot.Execute();
     }
 }
@@ -24,6 +24,7 @@ class MakefileGeneratorGint:
         flags_compile = self.config.get("compile_flags", "")
         flags_link = self.config.get("link_flags", "")
         memtrack = "ON" if self.config.get("memtrack", False) else "OFF"
+        fixed_no_float = "ON" if self.config.get("fixed_no_float", False) else "OFF"
 
         local = GetPathLinux(self.builder.distribution_path)
 
@@ -86,6 +87,10 @@ target_compile_options({self.output} PRIVATE
     -fno-builtin-new -fno-builtin-delete)
 target_compile_definitions({self.output} PRIVATE MEMTRACK_ENABLED=1)
 endif()
+option(FIXED_NO_FLOAT "Reject runtime float to fixed_t conversions" {fixed_no_float})
+if(FIXED_NO_FLOAT)
+target_compile_definitions({self.output} PRIVATE PARTICULE_FIXED_NO_FLOAT=1)
+endif()
 target_link_libraries({self.output} Gint::Gint LibProf::LibProf ${{LIBRARIES}} -lsupc++ -lstdc++ {flags_link})
 
 generate_g3a(TARGET {self.output} OUTPUT "{self.output}.g3a"
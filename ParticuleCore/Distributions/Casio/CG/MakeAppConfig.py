@@ -55,6 +55,7 @@ class MakeAppConfig(Distribution):
         self.icon_uns = VarPath("icon-uns.png", "Icon file for unselected application", filetypes=[("Image Files", "*.png")])
         self.icon_sel = VarPath("icon-sel.png", "Icon file for selected application", filetypes=[("Image Files", "*.png")])
         self.memtrack = VarBool(False, "Enable memory leak tracking")
+        self.fixed_no_float = VarBool(False, "Reject runtime float to fixed_t conversions (fixed literals only)")
 
     def validate(self) -> None:
         detect_wsl()
@@ -31,6 +31,8 @@ namespace Particule::Core
     
         constexpr int Width() const { return DefaultWidth; }
         constexpr int Height() const { return DefaultHeight; }
+        // VRAM courante (change à chaque dupdate avec le triple buffering)
+        inline ColorRaw* VideoMemory() { return gint_vram; }
     
         constexpr void SetWidth(int width)  { (void)width; }
         constexpr void SetHeight(int height){ (void)height; }
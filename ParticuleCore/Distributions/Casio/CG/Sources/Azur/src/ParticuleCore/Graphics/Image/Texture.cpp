@@ -1,5 +1,6 @@
 #include <Particule/Core/Graphics/Image/Texture.hpp>
 #include <Particule/Core/Graphics/Image/Sprite.hpp>
+#include <Particule/Core/Graphics/ColorKernels.hpp>
 #include <Particule/Core/Types/Fixed.hpp>
 #include <Particule/Core/Types/Vector2.hpp>
 #include <Particule/Core/System/gint.hpp>
@@ -114,20 +115,31 @@ namespace Particule::Core
         if (color.A() < 128) return;
         if (w == 0 || h == 0 || rect.w == 0 || rect.h == 0) return;
         Sampler2D sampler(x, y, w, h, rect, DWIDTH, DHEIGHT, img->width, img->height);
+        if (sampler.iteration.x <= 0) return;
+        uint16_t line[DWIDTH];
+        bool opaque[DWIDTH];
         fixed12_32 y2 = 0;
         for (int row = 0; row < sampler.iteration.y; ++row)
         {
             const int screenY = sampler.GetScreenY(row);
             const int texY = sampler.GetTexY(y2);
 
+            // Décodage de la ligne, teinte par lot, puis écriture des pixels opaques
             fixed12_32 x2 = 0;
             for (int col = 0; col < sampler.iteration.x; ++col)
             {
                 const int i = _getPixel(sampler.GetTexX(x2), texY);
-                if (i != _alphaValue)
-                    gint_vram[DWIDTH * (screenY) + (sampler.GetScreenX(col))] = Color::MultiplyColorRaw(_decodePixel(i), color.Raw());
+                opaque[col] = (i != _alphaValue);
+                line[col] = _decodePixel(i);
                 x2 += sampler.TexIncr.x;
             }
+            ColorKernels::Tint565(line, line, sampler.iteration.x, color.Raw());
+            uint16_t* dst = gint_vram + DWIDTH * screenY + sampler.GetScreenX(0);
+            for (int col = 0; col < sampler.iteration.x; ++col)
+            {
+                if (opaque[col])
+                    dst[col] = line[col];
+            }
             y2 += sampler.TexIncr.y;
         }
     }
@@ -1,6 +1,7 @@
 #ifndef COLOR_HPP
 #define COLOR_HPP
 #include <cstdint>
+#include <Particule/Core/Graphics/ColorKernels.hpp>
 
 namespace Particule::Core
 {
@@ -44,19 +45,7 @@ namespace Particule::Core
 
         static inline ColorRaw MultiplyColorRaw(ColorRaw a, ColorRaw b)
         {
-            const unsigned int ar = (a >> 11) & 0x1F;
-            const unsigned int ag = (a >> 5) & 0x3F;
-            const unsigned int ab = a & 0x1F;
-        
-            const unsigned int br = (b >> 11) & 0x1F;
-            const unsigned int bg = (b >> 5) & 0x3F;
-            const unsigned int bb = b & 0x1F;
-        
-            const unsigned int r = (ar * br + 15) / 31;
-            const unsigned int g = (ag * bg + 31) / 63;
-            const unsigned int b_ = (ab * bb + 15) / 31;
-        
-            return (r << 11) | (g << 5) | b_;
+            return ColorKernels::Tint565Pixel(a, b);
         }
     
         constexpr void Get(unsigned char& outR, unsigned char& outG, unsigned char& outB, unsigned char& outA) const {
@@ -2,6 +2,7 @@
 #define TEXTURE_HPP
 
 #include <Particule/Core/Graphics/Color.hpp>
+#include <Particule/Core/Graphics/Image/TextureSpan.hpp>
 #include <Particule/Core/Types/Rect.hpp>
 #include <Particule/Core/System/Window.hpp>
 #include <string>
@@ -120,6 +121,39 @@ namespace Particule::Core
             return true;
         }
 
+        //Draws a perspective-correct textured span into dst (VRAM row or framebuffer), texture repeated
+        //depth is optional (nullptr : no z-test); texels equal to the alpha key are skipped
+        inline virtual void DrawSpan(ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span)
+        {
+            DrawSpanImpl(this, dst, depth, count, span);
+        }
+
+        template<typename T>
+        static inline void DrawSpanImpl(T* self, ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span)
+        {
+            const int w = self->img->width;
+            const int h = self->img->height;
+            if (((w & (w - 1)) | (h & (h - 1))) == 0)
+                DrawSpanWrap<true>(self, dst, depth, count, span, w, h);
+            else
+                DrawSpanWrap<false>(self, dst, depth, count, span, w, h);
+        }
+
+        template<bool POW2, typename T>
+        static inline void DrawSpanWrap(T* self, ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span, int w, int h)
+        {
+            const int alpha = self->_alphaValue;
+            span.Walk(count, [&](int i, int32_t u, int32_t v, int32_t d) {
+                const uint16_t z = static_cast<uint16_t>(d >> TextureSpan::DEPTH_BITS);
+                if (depth != nullptr && z <= depth[i]) return;
+                const int p = self->_getPixel_inline(WrapTexel<POW2>(u >> TextureSpan::UV_BITS, w),
+                                                     WrapTexel<POW2>(v >> TextureSpan::UV_BITS, h));
+                if (p == alpha) return;
+                dst[i] = self->_decodePixel_inline(p);
+                if (depth != nullptr) depth[i] = z;
+            });
+        }
+
         Sprite* CreateSprite(Rect rect);
 
         static Texture* Load(std::string path);
@@ -156,6 +190,11 @@ namespace Particule::Core
         TextureP8(image_t* img) : Texture(img, false) {}
         TextureP8(image_t* img, bool isAllocated) : Texture(img, isAllocated) {}
 
+        inline void DrawSpan(ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span) override
+        {
+            DrawSpanImpl(this, dst, depth, count, span);
+        }
+
         inline void WritePixelRaw(int x, int y, const ColorRaw& color) override {
             (void)x; (void)y; (void)color;
             // No implementation needed for P8 texture
@@ -191,6 +230,11 @@ namespace Particule::Core
         TextureP4(image_t* img) : Texture(img, false) {}
         TextureP4(image_t* img, bool isAllocated) : Texture(img, isAllocated) {}
 
+        inline void DrawSpan(ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span) override
+        {
+            DrawSpanImpl(this, dst, depth, count, span);
+        }
+
         inline void WritePixelRaw(int x, int y, const ColorRaw& color) override {
             (void)x; (void)y; (void)color;
             // No implementation needed for P4 texture
@@ -0,0 +1,51 @@
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include <cstdint>
+
+namespace Particule::Core
+{
+    // Travail sur l'intervalle [begin, end[ ; data appartient à l'appelant
+    using JobFunction = void (*)(void* data, uint32_t begin, uint32_t end);
+
+    // Un seul thread : chaque job est terminé au retour de Run, le compteur reste à zéro
+    class JobCounter
+    {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter& other) = delete;
+        JobCounter& operator=(const JobCounter& other) = delete;
+
+        bool done() const { return true; }
+    };
+
+    // Pas de threads sur la calculatrice : tout est exécuté sur place, dans l'ordre des appels
+    class JobSystem
+    {
+    public:
+        static void Init(uint32_t workers = 0) { (void)workers; }
+        static void Shutdown() {}
+
+        static uint32_t WorkerCount() { return 0; }
+        static uint32_t ThreadCount() { return 1; }
+        static uint32_t ThreadIndex() { return 0; }
+
+        static void Run(JobFunction fn, void* data, uint32_t begin, uint32_t end,
+                        JobCounter* counter = nullptr, JobCounter* dependency = nullptr)
+        {
+            (void)counter;
+            (void)dependency;
+            fn(data, begin, end);
+        }
+        static void Wait(JobCounter& counter) { (void)counter; }
+
+        template <typename F>
+        static void ParallelFor(uint32_t count, uint32_t grain, F&& f)
+        {
+            (void)grain;
+            if (count) f(uint32_t(0), count);
+        }
+    };
+}
+
+#endif // JOBSYSTEM_HPP
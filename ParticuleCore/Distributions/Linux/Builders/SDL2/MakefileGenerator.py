@@ -36,7 +36,7 @@ CC = g++
 CPPFLAGS = -MMD
 CFLAGS = -std=c++20 -fcoroutines -D_GNU_SOURCE {define_flags} {self.compile_flags} {include_flags} `pkg-config --cflags sdl2 SDL2_image SDL2_ttf`
 LDFLAGS =
-LDLIBS = -lm `pkg-config --libs sdl2 SDL2_image SDL2_ttf` {self.link_flags}
+LDLIBS = -lm -pthread `pkg-config --libs sdl2 SDL2_image SDL2_ttf` {self.link_flags}
 
 OUTPUT = bin
 BUILD_DIR = build
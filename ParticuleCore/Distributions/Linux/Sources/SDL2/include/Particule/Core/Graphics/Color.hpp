@@ -2,6 +2,7 @@
 #define COLOR_HPP
 #include <cstddef>
 #include <cstdint>
+#include <Particule/Core/Graphics/ColorKernels.hpp>
 
 namespace Particule::Core
 {
@@ -58,12 +59,7 @@ namespace Particule::Core
 
         static inline ColorRaw MultiplyColorRaw(ColorRaw c1, ColorRaw c2)
         {
-            const uint8_t a = Mul8bit(c1 & 0xFF, c2 & 0xFF);
-            const uint8_t b = Mul8bit((c1 >> 8) & 0xFF, (c2 >> 8) & 0xFF);
-            const uint8_t g = Mul8bit((c1 >> 16) & 0xFF, (c2 >> 16) & 0xFF);
-            const uint8_t r = Mul8bit((c1 >> 24) & 0xFF, (c2 >> 24) & 0xFF);
-
-            return Pack(r, g, b, a);
+            return ColorKernels::TintRGBA8888Pixel(c1, c2);
         }
     
         constexpr void Get(unsigned char& outR, unsigned char& outG, unsigned char& outB, unsigned char& outA) const {
@@ -1,6 +1,7 @@
 #ifndef TEXTURE_HPP
 #define TEXTURE_HPP
 #include <Particule/Core/Graphics/Color.hpp>
+#include <Particule/Core/Graphics/Image/TextureSpan.hpp>
 #include <Particule/Core/Graphics/Shapes/Pixel.hpp>
 #include <Particule/Core/Types/Rect.hpp>
 #include <Particule/Core/System/Window.hpp>
@@ -18,9 +19,21 @@ namespace Particule::Core
         sdl2::SDL_Texture* texture;
         sdl2::SDL_Surface* surface;
         bool isWritable;
+        ColorRaw colorMod; // modulation couleur/alpha actuelle de la texture SDL
         Texture();
         Texture(const Texture& other);
         Texture& operator=(const Texture& other);
+
+        // Change la modulation seulement si elle diffère : des tracés consécutifs de même couleur ne touchent pas à l'état SDL
+        inline void SetColorMod(const Color& color)
+        {
+            if (colorMod == color.Raw()) return;
+            colorMod = color.Raw();
+            sdl2::SDL_SetTextureColorMod(texture, color.R(), color.G(), color.B());
+            sdl2::SDL_SetTextureAlphaMod(texture, color.A());
+        }
+        // Copie vers le renderer avec la modulation courante
+        void Blit(int x, int y, int w, int h, Rect rect);
     public:
         ~Texture();
         inline int Width(){ return surface->w; }
@@ -88,6 +101,10 @@ namespace Particule::Core
             return color.A() >= 128;
         };
 
+        //Draws a perspective-correct textured span into dst (framebuffer row), texture repeated
+        //depth is optional (nullptr : no z-test); texels with alpha < 128 are skipped
+        void DrawSpan(ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span);
+
         Sprite* CreateSprite(Rect rect);
 
         static Texture* Load(std::string path);
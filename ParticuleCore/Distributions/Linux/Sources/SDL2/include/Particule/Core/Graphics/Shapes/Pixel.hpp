@@ -10,7 +10,7 @@ namespace Particule::Core
     inline void DrawPixel(int x, int y, const Color& color)
     {
         Window* window = Window::GetCurrentWindow();
-        sdl2::SDL_SetRenderDrawColor(window->renderer, color.R(), color.G(), color.B(), color.A());
+        window->SetDrawColor(color);
         sdl2::SDL_RenderDrawPoint(window->renderer, x, y);
     }
 
@@ -18,7 +18,7 @@ namespace Particule::Core
     inline void DrawPixelUnsafe(int x, int y, const Color& color)
     {
         Window* window = Window::GetCurrentWindow();
-        sdl2::SDL_SetRenderDrawColor(window->renderer, color.R(), color.G(), color.B(), color.A());
+        window->SetDrawColor(color);
         sdl2::SDL_RenderDrawPoint(window->renderer, x, y);
     }
 
@@ -11,7 +11,7 @@ namespace Particule::Core
     inline void DrawRectOutline(int x, int y, int w, int h, const Color& color)
     {
         Window* window = Window::GetCurrentWindow();
-        sdl2::SDL_SetRenderDrawColor(window->renderer, color.R(), color.G(), color.B(), color.A());
+        window->SetDrawColor(color);
         sdl2::SDL_Rect rect = { x, y, w, h };
         sdl2::SDL_RenderDrawRect(window->renderer, &rect);
     }
@@ -19,7 +19,7 @@ namespace Particule::Core
     inline void DrawRectFilled(int x, int y, int w, int h, const Color& color)
     {
         Window* window = Window::GetCurrentWindow();
-        sdl2::SDL_SetRenderDrawColor(window->renderer, color.R(), color.G(), color.B(), color.A());
+        window->SetDrawColor(color);
         sdl2::SDL_Rect rect = { x, y, w, h };
         sdl2::SDL_RenderFillRect(window->renderer, &rect);
     }
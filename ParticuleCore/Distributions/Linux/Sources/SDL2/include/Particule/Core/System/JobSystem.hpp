@@ -0,0 +1,91 @@
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include <cstdint>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <type_traits>
+
+namespace Particule::Core
+{
+    // Travail sur l'intervalle [begin, end[ ; data appartient à l'appelant
+    using JobFunction = void (*)(void* data, uint32_t begin, uint32_t end);
+
+    class JobCounter;
+
+    struct Job
+    {
+        JobFunction fn;
+        void* data;
+        uint32_t begin;
+        uint32_t end;
+        JobCounter* counter;
+    };
+
+    // Nombre de jobs non terminés ; sert d'attente (JobSystem::Wait) et de dépendance (JobSystem::Run)
+    class JobCounter
+    {
+    private:
+        std::atomic<uint32_t> m_count;
+        std::vector<Job> m_waiting; // jobs qui dépendent de ce compteur, protégés par le JobSystem
+        friend class JobSystem;
+    public:
+        JobCounter() : m_count(0) {}
+        JobCounter(const JobCounter& other) = delete;
+        JobCounter& operator=(const JobCounter& other) = delete;
+
+        bool done() const { return m_count.load(std::memory_order_acquire) == 0; }
+    };
+
+    /*
+    Pool de threads à vol de travail : une file par thread, le propriétaire dépile ses derniers jobs,
+    les autres volent les plus anciens. Démarré au premier Run si Init n'a pas été appelé.
+    */
+    class JobSystem
+    {
+    private:
+        static void Push(const Job& job);
+        static void Execute(const Job& job);
+        static void WorkerLoop(uint32_t index);
+    public:
+        static void Init(uint32_t workers = 0); // 0 : un worker par cœur, moins le thread principal
+        static void Shutdown();
+
+        static uint32_t WorkerCount();  // 0 : exécution sur place
+        static uint32_t ThreadCount();  // workers + threads externes (index 0)
+        static uint32_t ThreadIndex();  // 0 hors worker, 1..WorkerCount() dans un worker
+
+        // Exécute fn(data, begin, end) ; counter incrémenté jusqu'à la fin du job,
+        // dependency : le job ne démarre qu'une fois ce compteur à zéro
+        static void Run(JobFunction fn, void* data, uint32_t begin, uint32_t end,
+                        JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+        // Attend counter en exécutant des jobs en attendant
+        static void Wait(JobCounter& counter);
+
+        // f(begin, end) sur [0, count[ découpé en tranches de grain éléments ; retourne quand tout est fait
+        template <typename F>
+        static void ParallelFor(uint32_t count, uint32_t grain, F&& f)
+        {
+            if (count == 0) return;
+            if (grain == 0) grain = 1;
+            if (count <= grain || WorkerCount() == 0)
+            {
+                f(uint32_t(0), count);
+                return;
+            }
+            using Fn = std::remove_reference_t<F>;
+            void* data = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+            JobCounter counter;
+            for (uint32_t begin = 0; begin < count; )
+            {
+                const uint32_t end = count - begin > grain ? begin + grain : count;
+                Run([](void* d, uint32_t b, uint32_t e) { (*static_cast<Fn*>(d))(b, e); }, data, begin, end, &counter);
+                begin = end;
+            }
+            Wait(counter);
+        }
+    };
+}
+
+#endif // JOBSYSTEM_HPP
@@ -5,6 +5,8 @@
 #include <cstddef>
 #define SDL_MAIN_HANDLED
 #include <string>
+// Les intrinsics SIMD doivent être inclus hors du namespace sdl2 (SDL_cpuinfo.h les inclut aussi)
+#include <Particule/Core/Graphics/ColorKernels.hpp>
 
 namespace sdl2
 {
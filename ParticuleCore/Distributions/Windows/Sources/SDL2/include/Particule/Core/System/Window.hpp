@@ -13,6 +13,8 @@ namespace Particule::Core
     {
     private:
         static thread_local Window* currentWindow;
+        ColorRaw drawColor = 0;     // dernière couleur donnée au renderer
+        bool hasDrawColor = false;
     public:
         sdl2::SDL_Window* window;
         sdl2::SDL_Renderer* renderer;
@@ -31,17 +33,28 @@ namespace Particule::Core
         virtual void UpdateInput();
         inline virtual void Clear()
         { 
-            sdl2::SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+            SetDrawColor(Color(0, 0, 0, 255));
             sdl2::SDL_RenderClear(renderer);
         }
         inline virtual void Clear(Color color)
         {
-            sdl2::SDL_SetRenderDrawColor(renderer, color.R(), color.G(), color.B(), color.A());
+            SetDrawColor(color);
             sdl2::SDL_RenderClear(renderer);
         }
+
+        // Couleur de dessin du renderer, envoyée à SDL seulement si elle change
+        inline void SetDrawColor(const Color& color)
+        {
+            if (hasDrawColor && drawColor == color.Raw()) return;
+            drawColor = color.Raw();
+            hasDrawColor = true;
+            sdl2::SDL_SetRenderDrawColor(renderer, color.R(), color.G(), color.B(), color.A());
+        }
     
         inline virtual int Width() { int w = 0; sdl2::SDL_GetWindowSize(window, &w, nullptr); return w; }
         inline virtual int Height() { int h = 0; sdl2::SDL_GetWindowSize(window, nullptr, &h); return h; }
+        // Rendu par le renderer SDL : pas d'accès direct à l'écran
+        inline ColorRaw* VideoMemory() { return nullptr; }
     
         inline void SetWidth(int width)  { sdl2::SDL_SetWindowSize(window, width, Height()); }
         inline void SetHeight(int height){ sdl2::SDL_SetWindowSize(window, Width(), height); }
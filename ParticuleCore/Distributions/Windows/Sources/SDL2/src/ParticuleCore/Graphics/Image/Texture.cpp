@@ -7,10 +7,25 @@
 
 namespace Particule::Core
 {
+    namespace
+    {
+        template<bool POW2>
+        void DrawSpanWrap(const uint32_t* pixels, int w, int h, ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span)
+        {
+            span.Walk(count, [&](int i, int32_t u, int32_t v, int32_t d) {
+                const uint16_t z = static_cast<uint16_t>(d >> TextureSpan::DEPTH_BITS);
+                if (depth != nullptr && z <= depth[i]) return;
+                const uint32_t p = pixels[WrapTexel<POW2>(v >> TextureSpan::UV_BITS, h) * w + WrapTexel<POW2>(u >> TextureSpan::UV_BITS, w)];
+                if ((p & 0xFF) < 128) return;
+                dst[i] = static_cast<ColorRaw>(p);
+                if (depth != nullptr) depth[i] = z;
+            });
+        }
+    }
 
-    Texture::Texture() : texture(nullptr), surface(nullptr), isWritable(false) {}
+    Texture::Texture() : texture(nullptr), surface(nullptr), isWritable(false), colorMod(0xFFFFFFFF) {}
 
-    Texture::Texture(const Texture& other) : texture(other.texture), surface(other.surface), isWritable(other.isWritable) {}
+    Texture::Texture(const Texture& other) : texture(other.texture), surface(other.surface), isWritable(other.isWritable), colorMod(other.colorMod) {}
 
     Texture& Texture::operator=(const Texture& other)
     {
@@ -19,6 +34,7 @@ namespace Particule::Core
             texture = other.texture;
             surface = other.surface;
             isWritable = other.isWritable;
+            colorMod = other.colorMod;
         }
         return *this;
     }
@@ -38,27 +54,24 @@ namespace Particule::Core
 
     void Texture::Draw(int x, int y)
     {
+        SetColorMod(Color::White);
         Window* window = Window::GetCurrentWindow();
         sdl2::SDL_Rect rect = {x, y, surface->w, surface->h};
         sdl2::SDL_RenderCopy(window->renderer, texture, nullptr, &rect);
     }
 
-    void Texture::DrawSub(int x, int y, Rect rect)
+    void Texture::Blit(int x, int y, int w, int h, Rect rect)
     {
-        Window* window = Window::GetCurrentWindow();
+        const bool sameSize = rect.w == w && rect.h == h;
         //change w and h if the rect is too big
         if (rect.x + rect.w > surface->w) rect.w = surface->w - rect.x;
         if (rect.y + rect.h > surface->h) rect.h = surface->h - rect.y;
-        sdl2::SDL_Rect dstRect = {x, y, rect.w, rect.h};
         sdl2::SDL_Rect srcRect = {rect.x, rect.y, rect.w, rect.h};
-        sdl2::SDL_RenderCopy(window->renderer, texture, &srcRect, &dstRect);
-    }
-
-    void Texture::DrawSubSize(int x, int y, int w, int h, Rect rect)
-    {
-        if (rect.w == w && rect.h == h)
+        Window* window = Window::GetCurrentWindow();
+        if (sameSize)
         {
-            DrawSub(x, y, rect);
+            sdl2::SDL_Rect dstRect = {x, y, rect.w, rect.h};
+            sdl2::SDL_RenderCopy(window->renderer, texture, &srcRect, &dstRect);
             return;
         }
         sdl2::SDL_RendererFlip flip = sdl2::SDL_FLIP_NONE;
@@ -66,34 +79,42 @@ namespace Particule::Core
             flip = static_cast<sdl2::SDL_RendererFlip>(flip | sdl2::SDL_FLIP_HORIZONTAL);
         if (h < 0)
             flip = static_cast<sdl2::SDL_RendererFlip>(flip | sdl2::SDL_FLIP_VERTICAL);
-        w = abs(w);
-        h = abs(h);
-        //change w and h if the rect is too big
-        if (rect.x + rect.w > surface->w) rect.w = surface->w - rect.x;
-        if (rect.y + rect.h > surface->h) rect.h = surface->h - rect.y;
-        sdl2::SDL_Rect dstRect = {x, y, w, h};
-        sdl2::SDL_Rect srcRect = {rect.x, rect.y, rect.w, rect.h};
-        Window* window = Window::GetCurrentWindow();
+        sdl2::SDL_Rect dstRect = {x, y, abs(w), abs(h)};
         sdl2::SDL_RenderCopyEx(window->renderer, texture, &srcRect, &dstRect, 0, nullptr, flip);
     }
 
+    void Texture::DrawSub(int x, int y, Rect rect)
+    {
+        SetColorMod(Color::White);
+        Blit(x, y, rect.w, rect.h, rect);
+    }
+
+    void Texture::DrawSubSize(int x, int y, int w, int h, Rect rect)
+    {
+        SetColorMod(Color::White);
+        Blit(x, y, w, h, rect);
+    }
+
     void Texture::DrawSubSizeColor(int x, int y, int w, int h, Rect rect, const Color& color)
     {
-        // Sauvegarde l’état courant de la texture
-        uint8_t oldR, oldG, oldB, oldA;
-        sdl2::SDL_GetTextureColorMod(texture, &oldR, &oldG, &oldB);
-        sdl2::SDL_GetTextureAlphaMod(texture, &oldA);
-        // Applique la nouvelle couleur
-        sdl2::SDL_SetTextureColorMod(texture, color.R(), color.G(), color.B());
-        sdl2::SDL_SetTextureAlphaMod(texture, color.A());
-        // Dessine la texture modifiée
-        DrawSubSize(x, y, w, h, rect);
-        // Restaure les valeurs précédentes de la texture
-        sdl2::SDL_SetTextureColorMod(texture, oldR, oldG, oldB);
-        sdl2::SDL_SetTextureAlphaMod(texture, oldA);
+        // La modulation reste en place après le tracé : seul un changement de couleur la renvoie à SDL
+        SetColorMod(color);
+        Blit(x, y, w, h, rect);
     }
 
 
+    void Texture::DrawSpan(ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span)
+    {
+        if (surface == nullptr || count <= 0) return;
+        const uint32_t* pixels = (const uint32_t*)surface->pixels;
+        const int w = surface->w;
+        const int h = surface->h;
+        if (((w & (w - 1)) | (h & (h - 1))) == 0)
+            DrawSpanWrap<true>(pixels, w, h, dst, depth, count, span);
+        else
+            DrawSpanWrap<false>(pixels, w, h, dst, depth, count, span);
+    }
+
     Sprite* Texture::CreateSprite(Rect rect)
     {
         return new Sprite(this, rect);
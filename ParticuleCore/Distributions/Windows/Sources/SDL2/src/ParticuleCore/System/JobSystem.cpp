@@ -0,0 +1,191 @@
+#include <Particule/Core/System/JobSystem.hpp>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace Particule::Core
+{
+    namespace
+    {
+        struct WorkQueue
+        {
+            std::mutex lock;
+            std::deque<Job> jobs;
+        };
+
+        struct JobState
+        {
+            std::mutex initLock;
+            std::atomic<bool> started{ false };
+            std::atomic<bool> running{ false };
+            std::vector<std::unique_ptr<WorkQueue>> queues; // 0 : threads externes, i : worker i
+            std::vector<std::thread> threads;
+            std::atomic<uint32_t> queued{ 0 };
+            std::mutex sleepLock;
+            std::condition_variable wake;
+            std::mutex counterLock; // compteurs et JobCounter::m_waiting
+
+            // Fin du programme sans Shutdown : les workers sont arrêtés, les jobs restants abandonnés
+            ~JobState()
+            {
+                {
+                    std::lock_guard<std::mutex> lk(sleepLock);
+                    running.store(false, std::memory_order_release);
+                }
+                wake.notify_all();
+                for (std::thread& t : threads) t.join();
+            }
+        };
+
+        JobState& State()
+        {
+            static JobState state;
+            return state;
+        }
+
+        thread_local uint32_t t_index = 0;
+
+        // Propre file par la fin (LIFO, cache chaud), sinon vol par le début des autres files
+        bool TryPop(JobState& s, Job& out)
+        {
+            const uint32_t n = static_cast<uint32_t>(s.queues.size());
+            if (n == 0 || s.queued.load(std::memory_order_acquire) == 0) return false;
+            for (uint32_t k = 0; k < n; ++k)
+            {
+                const uint32_t i = (t_index + k) % n;
+                WorkQueue& q = *s.queues[i];
+                std::lock_guard<std::mutex> guard(q.lock);
+                if (q.jobs.empty()) continue;
+                if (k == 0) { out = q.jobs.back(); q.jobs.pop_back(); }
+                else { out = q.jobs.front(); q.jobs.pop_front(); }
+                s.queued.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+            return false;
+        }
+    }
+
+    void JobSystem::WorkerLoop(uint32_t index)
+    {
+        JobState& s = State();
+        t_index = index;
+        Job job;
+        while (s.running.load(std::memory_order_acquire))
+        {
+            if (TryPop(s, job))
+            {
+                Execute(job);
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(s.sleepLock);
+            s.wake.wait(lk, [&] { return s.queued.load(std::memory_order_acquire) > 0 || !s.running.load(std::memory_order_acquire); });
+        }
+    }
+
+    void JobSystem::Init(uint32_t workers)
+    {
+        JobState& s = State();
+        std::lock_guard<std::mutex> guard(s.initLock);
+        if (s.started.load(std::memory_order_acquire)) return;
+        if (workers == 0)
+        {
+            const uint32_t cores = std::thread::hardware_concurrency();
+            workers = cores > 1 ? cores - 1 : 0;
+        }
+        s.queues.clear();
+        for (uint32_t i = 0; i <= workers; ++i)
+            s.queues.push_back(std::make_unique<WorkQueue>());
+        s.running.store(true, std::memory_order_release);
+        for (uint32_t i = 1; i <= workers; ++i)
+            s.threads.emplace_back(WorkerLoop, i);
+        s.started.store(true, std::memory_order_release);
+    }
+
+    void JobSystem::Shutdown()
+    {
+        JobState& s = State();
+        std::lock_guard<std::mutex> guard(s.initLock);
+        if (!s.started.load(std::memory_order_acquire)) return;
+        {
+            std::lock_guard<std::mutex> lk(s.sleepLock);
+            s.running.store(false, std::memory_order_release);
+        }
+        s.wake.notify_all();
+        for (std::thread& t : s.threads) t.join();
+        s.threads.clear();
+        // Jobs restants exécutés ici pour que les compteurs retombent à zéro
+        Job job;
+        while (TryPop(s, job)) Execute(job);
+        s.queues.clear();
+        s.started.store(false, std::memory_order_release);
+    }
+
+    uint32_t JobSystem::WorkerCount()
+    {
+        if (!State().started.load(std::memory_order_acquire)) Init();
+        return static_cast<uint32_t>(State().threads.size());
+    }
+
+    uint32_t JobSystem::ThreadCount() { return WorkerCount() + 1; }
+
+    uint32_t JobSystem::ThreadIndex() { return t_index; }
+
+    void JobSystem::Push(const Job& job)
+    {
+        JobState& s = State();
+        {
+            WorkQueue& q = *s.queues[t_index];
+            std::lock_guard<std::mutex> guard(q.lock);
+            q.jobs.push_back(job);
+            s.queued.fetch_add(1, std::memory_order_acq_rel);
+        }
+        { std::lock_guard<std::mutex> lk(s.sleepLock); } // pas de réveil perdu entre le test et l'attente d'un worker
+        s.wake.notify_one();
+    }
+
+    void JobSystem::Execute(const Job& job)
+    {
+        job.fn(job.data, job.begin, job.end);
+        JobCounter* counter = job.counter;
+        if (!counter) return;
+        std::vector<Job> released;
+        {
+            std::lock_guard<std::mutex> guard(State().counterLock);
+            if (counter->m_count.load(std::memory_order_relaxed) == 1)
+                released.swap(counter->m_waiting); // dernier job : libère ceux qui en dépendaient
+            // Dernier accès au compteur : Wait peut le détruire dès qu'il passe à zéro
+            counter->m_count.fetch_sub(1, std::memory_order_release);
+        }
+        for (const Job& next : released) Push(next);
+    }
+
+    void JobSystem::Run(JobFunction fn, void* data, uint32_t begin, uint32_t end, JobCounter* counter, JobCounter* dependency)
+    {
+        if (!State().started.load(std::memory_order_acquire)) Init();
+        const Job job{ fn, data, begin, end, counter };
+        if (counter || dependency)
+        {
+            std::lock_guard<std::mutex> guard(State().counterLock);
+            if (counter) counter->m_count.fetch_add(1, std::memory_order_relaxed);
+            if (dependency && !dependency->done())
+            {
+                dependency->m_waiting.push_back(job);
+                return;
+            }
+        }
+        if (State().threads.empty()) Execute(job);
+        else Push(job);
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        JobState& s = State();
+        Job job;
+        while (!counter.done())
+        {
+            if (TryPop(s, job)) Execute(job);
+            else std::this_thread::yield();
+        }
+    }
+}
@@ -0,0 +1,554 @@
+#ifndef COLOR_KERNELS_HPP
+#define COLOR_KERNELS_HPP
+
+#include <Particule/Core/System/Basic.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define PARTICULE_COLOR_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define PARTICULE_COLOR_SSE2 1
+#endif
+#if defined(__ARM_NEON) && (!defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    #include <arm_neon.h>
+    #define PARTICULE_COLOR_NEON 1
+#endif
+
+/*
+Noyaux de couleur par lots (spans) pour les chemins de rendu logiciel.
+
+Deux formats sont gérés :
+  - RGB565   (uint16_t)  : VRAM Casio, textures RGB16 / palettes P8 et P4
+  - RGBA8888 (uint32_t)  : R<<24 | G<<16 | B<<8 | A, comme le ColorRaw SDL2
+
+Chaque opération existe en version pixel (référence scalaire) et en version span.
+Les versions span utilisent AVX2 / SSE2 / NEON quand le compilateur les expose,
+sinon du SWAR 32 bits (deux pixels 565 par mot, cas du SH4) puis le scalaire pour la fin.
+Tous les chemins donnent exactement le même résultat que la référence scalaire.
+dst peut être égal à src (traitement en place).
+*/
+
+namespace Particule::Core::ColorKernels
+{
+    // ---------------------------------------------------------------------
+    // Références scalaires RGB565
+    // ---------------------------------------------------------------------
+
+    // (a * b + 15) / 31 sans division, exact pour a, b <= 31
+    FORCE_INLINE constexpr uint32_t Div31(uint32_t x) { x += 15; return (x + (x >> 5) + 1) >> 5; }
+    // (a * b + 31) / 63 sans division, exact pour a, b <= 63
+    FORCE_INLINE constexpr uint32_t Div63(uint32_t x) { x += 31; return (x + (x >> 6) + 1) >> 6; }
+
+    // Multiplie deux couleurs 565 canal par canal (teinte)
+    FORCE_INLINE constexpr uint16_t Tint565Pixel(uint16_t c, uint16_t tint)
+    {
+        const uint32_t r = Div31(((c >> 11) & 0x1F) * ((tint >> 11) & 0x1F));
+        const uint32_t g = Div63(((c >> 5) & 0x3F) * ((tint >> 5) & 0x3F));
+        const uint32_t b = Div31((c & 0x1F) * (tint & 0x1F));
+        return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+    }
+
+    // Alpha 0..255 -> facteur 0..32 utilisé par les mélanges 565
+    FORCE_INLINE constexpr uint32_t Alpha565(uint8_t alpha) { return (static_cast<uint32_t>(alpha) + 4) >> 3; }
+
+    // Mélange src sur dst avec un facteur 0..32 (dst + (src - dst) * a / 32, arrondi vers le bas)
+    FORCE_INLINE constexpr uint16_t Blend565Pixel(uint16_t dst, uint16_t src, uint32_t a5)
+    {
+        const uint32_t fg = (src | (static_cast<uint32_t>(src) << 16)) & 0x07E0F81Fu;
+        const uint32_t bg = (dst | (static_cast<uint32_t>(dst) << 16)) & 0x07E0F81Fu;
+        const uint32_t res = ((((fg - bg) * a5) >> 5) + bg) & 0x07E0F81Fu;
+        return static_cast<uint16_t>((res >> 16) | res);
+    }
+
+    // Addition saturée canal par canal
+    FORCE_INLINE constexpr uint16_t Add565Pixel(uint16_t dst, uint16_t src)
+    {
+        // Format étendu 0x07E0F81F : chaque canal a des bits de garde pour sa retenue
+        const uint32_t fg = (src | (static_cast<uint32_t>(src) << 16)) & 0x07E0F81Fu;
+        const uint32_t bg = (dst | (static_cast<uint32_t>(dst) << 16)) & 0x07E0F81Fu;
+        uint32_t sum = fg + bg;
+        const uint32_t ov = sum & 0x08010020u; // retenues de B (bit 5), R (bit 16), G (bit 27)
+        sum |= ((ov >> 5) & 1u) * 0x0000001Fu
+             | ((ov >> 16) & 1u) * 0x0000F800u
+             | ((ov >> 27) & 1u) * 0x07E00000u;
+        sum &= 0x07E0F81Fu;
+        return static_cast<uint16_t>((sum >> 16) | sum);
+    }
+
+    // ---------------------------------------------------------------------
+    // Références scalaires RGBA8888
+    // ---------------------------------------------------------------------
+
+    // a * b / 255 arrondi, exact pour a, b <= 255
+    FORCE_INLINE constexpr uint32_t Mul8(uint32_t a, uint32_t b)
+    {
+        const uint32_t t = a * b + 128;
+        return (t + (t >> 8)) >> 8;
+    }
+
+    FORCE_INLINE constexpr uint32_t TintRGBA8888Pixel(uint32_t c, uint32_t tint)
+    {
+        return (Mul8(c >> 24, tint >> 24) << 24)
+             | (Mul8((c >> 16) & 0xFF, (tint >> 16) & 0xFF) << 16)
+             | (Mul8((c >> 8) & 0xFF, (tint >> 8) & 0xFF) << 8)
+             |  Mul8(c & 0xFF, tint & 0xFF);
+    }
+
+    // Mélange "source over" avec l'alpha du pixel source
+    FORCE_INLINE constexpr uint32_t BlendRGBA8888Pixel(uint32_t dst, uint32_t src)
+    {
+        const uint32_t sa = src & 0xFF;
+        const uint32_t ia = 255 - sa;
+        return ((Mul8(src >> 24, sa) + Mul8(dst >> 24, ia)) << 24)
+             | ((Mul8((src >> 16) & 0xFF, sa) + Mul8((dst >> 16) & 0xFF, ia)) << 16)
+             | ((Mul8((src >> 8) & 0xFF, sa) + Mul8((dst >> 8) & 0xFF, ia)) << 8)
+             |  (sa + Mul8(dst & 0xFF, ia));
+    }
+
+    FORCE_INLINE constexpr uint32_t AddRGBA8888Pixel(uint32_t dst, uint32_t src)
+    {
+        uint32_t out = 0;
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            const uint32_t c = ((dst >> shift) & 0xFF) + ((src >> shift) & 0xFF);
+            out |= (c > 0xFF ? 0xFFu : c) << shift;
+        }
+        return out;
+    }
+
+    // ---------------------------------------------------------------------
+    // Helpers SIMD internes
+    // ---------------------------------------------------------------------
+    namespace Detail
+    {
+#if defined(PARTICULE_COLOR_SSE2)
+        // Canal 565 isolé dans des voies 16 bits : (v * t + bias) / max
+        FORCE_INLINE __m128i Tint565Lanes(__m128i v, __m128i tr, __m128i tg, __m128i tb)
+        {
+            const __m128i m5 = _mm_set1_epi16(0x1F);
+            const __m128i m6 = _mm_set1_epi16(0x3F);
+            const __m128i one = _mm_set1_epi16(1);
+            __m128i r = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 11), m5), tr), _mm_set1_epi16(15));
+            __m128i g = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 5), m6), tg), _mm_set1_epi16(31));
+            __m128i b = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(v, m5), tb), _mm_set1_epi16(15));
+            r = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(r, _mm_srli_epi16(r, 5)), one), 5);
+            g = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(g, _mm_srli_epi16(g, 6)), one), 6);
+            b = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(b, _mm_srli_epi16(b, 5)), one), 5);
+            return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+        }
+
+        // d + ((s - d) * a) >> 5 sur un canal (voies signées)
+        FORCE_INLINE __m128i BlendLanes(__m128i s, __m128i d, __m128i a)
+        {
+            return _mm_add_epi16(d, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(s, d), a), 5));
+        }
+
+        // Mul8 sur des voies 16 bits
+        FORCE_INLINE __m128i Mul8Lanes(__m128i a, __m128i b)
+        {
+            const __m128i t = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+            return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        }
+
+        // Facteurs source / destination d'un mélange pour deux pixels dépliés en 16 bits
+        FORCE_INLINE void BlendFactors(__m128i px, __m128i& srcMul, __m128i& dstMul)
+        {
+            const __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(px, 0x00), 0x00);
+            const __m128i keep = _mm_set_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+            const __m128i full = _mm_set_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+            srcMul = _mm_or_si128(_mm_and_si128(a, keep), full);
+            dstMul = _mm_sub_epi16(_mm_set1_epi16(255), a);
+        }
+#endif
+
+#if defined(PARTICULE_COLOR_AVX2)
+        FORCE_INLINE __m256i Tint565Lanes(__m256i v, __m256i tr, __m256i tg, __m256i tb)
+        {
+            const __m256i m5 = _mm256_set1_epi16(0x1F);
+            const __m256i m6 = _mm256_set1_epi16(0x3F);
+            const __m256i one = _mm256_set1_epi16(1);
+            __m256i r = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(v, 11), m5), tr), _mm256_set1_epi16(15));
+            __m256i g = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(v, 5), m6), tg), _mm256_set1_epi16(31));
+            __m256i b = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_and_si256(v, m5), tb), _mm256_set1_epi16(15));
+            r = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(r, _mm256_srli_epi16(r, 5)), one), 5);
+            g = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(g, _mm256_srli_epi16(g, 6)), one), 6);
+            b = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(b, _mm256_srli_epi16(b, 5)), one), 5);
+            return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)), b);
+        }
+
+        FORCE_INLINE __m256i Mul8Lanes(__m256i a, __m256i b)
+        {
+            const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(a, b), _mm256_set1_epi16(128));
+            return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+        }
+
+        FORCE_INLINE void BlendFactors(__m256i px, __m256i& srcMul, __m256i& dstMul)
+        {
+            const __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(px, 0x00), 0x00);
+            const __m256i keep = _mm256_set_epi16(-1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0);
+            const __m256i full = _mm256_set_epi16(0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255);
+            srcMul = _mm256_or_si256(_mm256_and_si256(a, keep), full);
+            dstMul = _mm256_sub_epi16(_mm256_set1_epi16(255), a);
+        }
+#endif
+
+#if defined(PARTICULE_COLOR_NEON)
+        FORCE_INLINE uint16x8_t Tint565Lanes(uint16x8_t v, uint16x8_t tr, uint16x8_t tg, uint16x8_t tb)
+        {
+            const uint16x8_t one = vdupq_n_u16(1);
+            uint16x8_t r = vaddq_u16(vmulq_u16(vshrq_n_u16(v, 11), tr), vdupq_n_u16(15));
+            uint16x8_t g = vaddq_u16(vmulq_u16(vandq_u16(vshrq_n_u16(v, 5), vdupq_n_u16(0x3F)), tg), vdupq_n_u16(31));
+            uint16x8_t b = vaddq_u16(vmulq_u16(vandq_u16(v, vdupq_n_u16(0x1F)), tb), vdupq_n_u16(15));
+            r = vshrq_n_u16(vaddq_u16(vsraq_n_u16(r, r, 5), one), 5);
+            g = vshrq_n_u16(vaddq_u16(vsraq_n_u16(g, g, 6), one), 6);
+            b = vshrq_n_u16(vaddq_u16(vsraq_n_u16(b, b, 5), one), 5);
+            return vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), b);
+        }
+
+        // Mul8 sur 8 octets : (p + 128 + ((p + 128) >> 8)) >> 8
+        FORCE_INLINE uint8x8_t Mul8Lanes(uint8x8_t a, uint8x8_t b)
+        {
+            const uint16x8_t p = vmull_u8(a, b);
+            return vrshrn_n_u16(vrsraq_n_u16(p, p, 8), 8);
+        }
+#endif
+    }
+
+    // ---------------------------------------------------------------------
+    // Spans RGB565
+    // ---------------------------------------------------------------------
+
+    // dst[i] = src[i] * tint
+    inline void Tint565(uint16_t* dst, const uint16_t* src, size_t count, uint16_t tint)
+    {
+        size_t i = 0;
+#if defined(PARTICULE_COLOR_AVX2)
+        {
+            const __m256i tr = _mm256_set1_epi16((tint >> 11) & 0x1F);
+            const __m256i tg = _mm256_set1_epi16((tint >> 5) & 0x3F);
+            const __m256i tb = _mm256_set1_epi16(tint & 0x1F);
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Detail::Tint565Lanes(v, tr, tg, tb));
+            }
+        }
+#endif
+#if defined(PARTICULE_COLOR_SSE2)
+        {
+            const __m128i tr = _mm_set1_epi16((tint >> 11) & 0x1F);
+            const __m128i tg = _mm_set1_epi16((tint >> 5) & 0x3F);
+            const __m128i tb = _mm_set1_epi16(tint & 0x1F);
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Detail::Tint565Lanes(v, tr, tg, tb));
+            }
+        }
+#elif defined(PARTICULE_COLOR_NEON)
+        {
+            const uint16x8_t tr = vdupq_n_u16((tint >> 11) & 0x1F);
+            const uint16x8_t tg = vdupq_n_u16((tint >> 5) & 0x3F);
+            const uint16x8_t tb = vdupq_n_u16(tint & 0x1F);
+            for (; i + 8 <= count; i += 8)
+                vst1q_u16(dst + i, Detail::Tint565Lanes(vld1q_u16(src + i), tr, tg, tb));
+        }
+#else
+        {
+            // SWAR : deux pixels 565 par mot de 32 bits, chaque canal dans une voie de 16 bits
+            const uint32_t tr = (tint >> 11) & 0x1F;
+            const uint32_t tg = (tint >> 5) & 0x3F;
+            const uint32_t tb = tint & 0x1F;
+            constexpr uint32_t ones = 0x00010001u;
+            for (; i + 2 <= count; i += 2)
+            {
+                uint32_t w;
+                std::memcpy(&w, src + i, sizeof(w));
+                uint32_t r = ((w >> 11) & 0x001F001Fu) * tr + 15 * ones;
+                uint32_t g = ((w >> 5) & 0x003F003Fu) * tg + 31 * ones;
+                uint32_t b = (w & 0x001F001Fu) * tb + 15 * ones;
+                r = ((r + ((r >> 5) & 0x001F001Fu) + ones) >> 5) & 0x001F001Fu;
+                g = ((g + ((g >> 6) & 0x003F003Fu) + ones) >> 6) & 0x003F003Fu;
+                b = ((b + ((b >> 5) & 0x001F001Fu) + ones) >> 5) & 0x001F001Fu;
+                w = (r << 11) | (g << 5) | b;
+                std::memcpy(dst + i, &w, sizeof(w));
+            }
+        }
+#endif
+        for (; i < count; ++i)
+            dst[i] = Tint565Pixel(src[i], tint);
+    }
+
+    // dst[i] = mélange de src[i] sur dst[i] avec un alpha constant 0..255
+    inline void Blend565(uint16_t* dst, const uint16_t* src, size_t count, uint8_t alpha)
+    {
+        const uint32_t a5 = Alpha565(alpha);
+        if (a5 == 0) return;
+        if (a5 == 32) { if (dst != src) std::memmove(dst, src, count * sizeof(uint16_t)); return; }
+        size_t i = 0;
+#if defined(PARTICULE_COLOR_SSE2)
+        {
+            const __m128i a = _mm_set1_epi16(static_cast<short>(a5));
+            const __m128i m5 = _mm_set1_epi16(0x1F);
+            const __m128i m6 = _mm_set1_epi16(0x3F);
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                const __m128i r = Detail::BlendLanes(_mm_srli_epi16(s, 11), _mm_srli_epi16(d, 11), a);
+                const __m128i g = Detail::BlendLanes(_mm_and_si128(_mm_srli_epi16(s, 5), m6), _mm_and_si128(_mm_srli_epi16(d, 5), m6), a);
+                const __m128i b = Detail::BlendLanes(_mm_and_si128(s, m5), _mm_and_si128(d, m5), a);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                    _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b));
+            }
+        }
+#elif defined(PARTICULE_COLOR_NEON)
+        {
+            const int16x8_t a = vdupq_n_s16(static_cast<int16_t>(a5));
+            auto lanes = [&](uint16x8_t s, uint16x8_t d) {
+                const int16x8_t sd = vreinterpretq_s16_u16(d);
+                return vreinterpretq_u16_s16(vaddq_s16(sd, vshrq_n_s16(vmulq_s16(vsubq_s16(vreinterpretq_s16_u16(s), sd), a), 5)));
+            };
+            const uint16x8_t m5 = vdupq_n_u16(0x1F);
+            const uint16x8_t m6 = vdupq_n_u16(0x3F);
+            for (; i + 8 <= count; i += 8)
+            {
+                const uint16x8_t s = vld1q_u16(src + i);
+                const uint16x8_t d = vld1q_u16(dst + i);
+                const uint16x8_t r = lanes(vshrq_n_u16(s, 11), vshrq_n_u16(d, 11));
+                const uint16x8_t g = lanes(vandq_u16(vshrq_n_u16(s, 5), m6), vandq_u16(vshrq_n_u16(d, 5), m6));
+                const uint16x8_t b = lanes(vandq_u16(s, m5), vandq_u16(d, m5));
+                vst1q_u16(dst + i, vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), b));
+            }
+        }
+#endif
+        // Le format étendu 0x07E0F81F est déjà un SWAR par pixel sur 32 bits
+        for (; i < count; ++i)
+            dst[i] = Blend565Pixel(dst[i], src[i], a5);
+    }
+
+    // dst[i] = min(dst[i] + src[i], max) canal par canal
+    inline void Add565(uint16_t* dst, const uint16_t* src, size_t count)
+    {
+        size_t i = 0;
+#if defined(PARTICULE_COLOR_SSE2)
+        {
+            const __m128i m5 = _mm_set1_epi16(0x1F);
+            const __m128i m6 = _mm_set1_epi16(0x3F);
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                // Canaux replacés en haut d'octet : l'addition saturée 8 bits fait le clamp
+                const __m128i r = _mm_adds_epu8(_mm_slli_epi16(_mm_srli_epi16(s, 11), 3), _mm_slli_epi16(_mm_srli_epi16(d, 11), 3));
+                const __m128i g = _mm_adds_epu8(_mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(s, 5), m6), 2), _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(d, 5), m6), 2));
+                const __m128i b = _mm_adds_epu8(_mm_slli_epi16(_mm_and_si128(s, m5), 3), _mm_slli_epi16(_mm_and_si128(d, m5), 3));
+                const __m128i out = _mm_or_si128(_mm_or_si128(
+                    _mm_slli_epi16(_mm_srli_epi16(r, 3), 11),
+                    _mm_slli_epi16(_mm_srli_epi16(g, 2), 5)),
+                    _mm_srli_epi16(b, 3));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+            }
+        }
+#elif defined(PARTICULE_COLOR_NEON)
+        {
+            const uint16x8_t m5 = vdupq_n_u16(0x1F);
+            const uint16x8_t m6 = vdupq_n_u16(0x3F);
+            for (; i + 8 <= count; i += 8)
+            {
+                const uint16x8_t s = vld1q_u16(src + i);
+                const uint16x8_t d = vld1q_u16(dst + i);
+                const uint16x8_t r = vminq_u16(vaddq_u16(vshrq_n_u16(s, 11), vshrq_n_u16(d, 11)), m5);
+                const uint16x8_t g = vminq_u16(vaddq_u16(vandq_u16(vshrq_n_u16(s, 5), m6), vandq_u16(vshrq_n_u16(d, 5), m6)), m6);
+                const uint16x8_t b = vminq_u16(vaddq_u16(vandq_u16(s, m5), vandq_u16(d, m5)), m5);
+                vst1q_u16(dst + i, vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), b));
+            }
+        }
+#endif
+        for (; i < count; ++i)
+            dst[i] = Add565Pixel(dst[i], src[i]);
+    }
+
+    // ---------------------------------------------------------------------
+    // Spans RGBA8888
+    // ---------------------------------------------------------------------
+
+    inline void TintRGBA8888(uint32_t* dst, const uint32_t* src, size_t count, uint32_t tint)
+    {
+        size_t i = 0;
+#if defined(PARTICULE_COLOR_AVX2)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i t = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(tint)), zero);
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i lo = Detail::Mul8Lanes(_mm256_unpacklo_epi8(v, zero), t);
+                const __m256i hi = Detail::Mul8Lanes(_mm256_unpackhi_epi8(v, zero), t);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(lo, hi));
+            }
+        }
+#endif
+#if defined(PARTICULE_COLOR_SSE2)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i t = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(tint)), zero);
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i lo = Detail::Mul8Lanes(_mm_unpacklo_epi8(v, zero), t);
+                const __m128i hi = Detail::Mul8Lanes(_mm_unpackhi_epi8(v, zero), t);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+            }
+        }
+#elif defined(PARTICULE_COLOR_NEON)
+        {
+            const uint8x8_t t = vreinterpret_u8_u32(vdup_n_u32(tint));
+            for (; i + 2 <= count; i += 2)
+            {
+                const uint8x8_t v = vreinterpret_u8_u32(vld1_u32(src + i));
+                vst1_u32(dst + i, vreinterpret_u32_u8(Detail::Mul8Lanes(v, t)));
+            }
+        }
+#endif
+        for (; i < count; ++i)
+            dst[i] = TintRGBA8888Pixel(src[i], tint);
+    }
+
+    inline void BlendRGBA8888(uint32_t* dst, const uint32_t* src, size_t count)
+    {
+        size_t i = 0;
+#if defined(PARTICULE_COLOR_AVX2)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+                __m256i sm, dm;
+                const __m256i slo = _mm256_unpacklo_epi8(s, zero);
+                Detail::BlendFactors(slo, sm, dm);
+                const __m256i lo = _mm256_add_epi16(Detail::Mul8Lanes(slo, sm), Detail::Mul8Lanes(_mm256_unpacklo_epi8(d, zero), dm));
+                const __m256i shi = _mm256_unpackhi_epi8(s, zero);
+                Detail::BlendFactors(shi, sm, dm);
+                const __m256i hi = _mm256_add_epi16(Detail::Mul8Lanes(shi, sm), Detail::Mul8Lanes(_mm256_unpackhi_epi8(d, zero), dm));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(lo, hi));
+            }
+        }
+#endif
+#if defined(PARTICULE_COLOR_SSE2)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                __m128i sm, dm;
+                const __m128i slo = _mm_unpacklo_epi8(s, zero);
+                Detail::BlendFactors(slo, sm, dm);
+                const __m128i lo = _mm_add_epi16(Detail::Mul8Lanes(slo, sm), Detail::Mul8Lanes(_mm_unpacklo_epi8(d, zero), dm));
+                const __m128i shi = _mm_unpackhi_epi8(s, zero);
+                Detail::BlendFactors(shi, sm, dm);
+                const __m128i hi = _mm_add_epi16(Detail::Mul8Lanes(shi, sm), Detail::Mul8Lanes(_mm_unpackhi_epi8(d, zero), dm));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+            }
+        }
+#elif defined(PARTICULE_COLOR_NEON)
+        {
+            for (; i + 2 <= count; i += 2)
+            {
+                const uint32x2_t s32 = vld1_u32(src + i);
+                // Alpha (octet de poids faible) diffusé sur les 4 octets du pixel
+                const uint32x2_t a32 = vmul_u32(vand_u32(s32, vdup_n_u32(0xFF)), vdup_n_u32(0x01010101u));
+                const uint8x8_t sm = vreinterpret_u8_u32(vorr_u32(a32, vdup_n_u32(0xFF)));
+                const uint8x8_t dm = vsub_u8(vdup_n_u8(255), vreinterpret_u8_u32(a32));
+                const uint8x8_t s = vreinterpret_u8_u32(s32);
+                const uint8x8_t d = vreinterpret_u8_u32(vld1_u32(dst + i));
+                vst1_u32(dst + i, vreinterpret_u32_u8(vadd_u8(Detail::Mul8Lanes(s, sm), Detail::Mul8Lanes(d, dm))));
+            }
+        }
+#endif
+        for (; i < count; ++i)
+            dst[i] = BlendRGBA8888Pixel(dst[i], src[i]);
+    }
+
+    inline void AddRGBA8888(uint32_t* dst, const uint32_t* src, size_t count)
+    {
+        size_t i = 0;
+#if defined(PARTICULE_COLOR_AVX2)
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_adds_epu8(s, d));
+        }
+#endif
+#if defined(PARTICULE_COLOR_SSE2)
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epu8(s, d));
+        }
+#elif defined(PARTICULE_COLOR_NEON)
+        for (; i + 4 <= count; i += 4)
+        {
+            const uint8x16_t s = vreinterpretq_u8_u32(vld1q_u32(src + i));
+            const uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(dst + i));
+            vst1q_u32(dst + i, vreinterpretq_u32_u8(vqaddq_u8(s, d)));
+        }
+#endif
+        for (; i < count; ++i)
+            dst[i] = AddRGBA8888Pixel(dst[i], src[i]);
+    }
+
+    // ---------------------------------------------------------------------
+    // Expansion de palettes (P8 / P4) vers 565 ou 8888
+    // ---------------------------------------------------------------------
+
+    // P8 : index signés, palette décalée de 128 (format gint)
+    template<typename Pixel, typename PaletteEntry>
+    inline void ExpandP8(Pixel* dst, const uint8_t* src, size_t count, const PaletteEntry* palette)
+    {
+        const PaletteEntry* pal = palette + 128;
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const Pixel p0 = static_cast<Pixel>(pal[static_cast<int8_t>(src[i])]);
+            const Pixel p1 = static_cast<Pixel>(pal[static_cast<int8_t>(src[i + 1])]);
+            const Pixel p2 = static_cast<Pixel>(pal[static_cast<int8_t>(src[i + 2])]);
+            const Pixel p3 = static_cast<Pixel>(pal[static_cast<int8_t>(src[i + 3])]);
+            dst[i] = p0; dst[i + 1] = p1; dst[i + 2] = p2; dst[i + 3] = p3;
+        }
+        for (; i < count; ++i)
+            dst[i] = static_cast<Pixel>(pal[static_cast<int8_t>(src[i])]);
+    }
+
+    // P4 : deux index par octet, quartet de poids fort en premier ; x0 est la colonne de départ
+    template<typename Pixel, typename PaletteEntry>
+    inline void ExpandP4(Pixel* dst, const uint8_t* src, int x0, size_t count, const PaletteEntry* palette)
+    {
+        size_t i = 0;
+        if (count > 0 && (x0 & 1))
+        {
+            dst[i++] = static_cast<Pixel>(palette[src[x0 >> 1] & 0x0F]);
+            ++x0;
+        }
+        const uint8_t* bytes = src + (x0 >> 1);
+        for (; i + 2 <= count; i += 2, ++bytes)
+        {
+            const uint8_t b = *bytes;
+            dst[i] = static_cast<Pixel>(palette[b >> 4]);
+            dst[i + 1] = static_cast<Pixel>(palette[b & 0x0F]);
+        }
+        if (i < count)
+            dst[i] = static_cast<Pixel>(palette[*bytes >> 4]);
+    }
+}
+
+#endif // COLOR_KERNELS_HPP
@@ -1,6 +1,7 @@
 #ifndef SPRITE_HPP
 #define SPRITE_HPP
 #include <Particule/Core/Graphics/Image/Texture.hpp>
+#include <Particule/Core/Graphics/Image/CollisionMask.hpp>
 #include <Particule/Core/Graphics/Color.hpp>
 #include <Particule/Core/Types/Rect.hpp>
 #include <Particule/Core/System/Window.hpp>
@@ -8,6 +9,7 @@
 #include <Particule/Core/System/AssetManager.hpp>
 #include <Particule/Core/Types/Fixed.hpp>
 #include <string>
+#include <memory>
 
 namespace Particule::Core
 {
@@ -16,18 +18,20 @@ namespace Particule::Core
     private:
         Asset<Texture> texture;
         Rect rect;
+        std::shared_ptr<const CollisionMask> mask; // construit au premier GetCollisionMask, partagé par les copies
     public:
         Sprite() = default;
         Sprite(Asset<Texture> asset_texture, Rect rect) : texture(std::move(asset_texture)), rect(rect) {}
         Sprite(Texture* texture, Rect rect) : texture(texture), rect(rect) {}
         Sprite(uint32_t assetID, Rect rect) : texture(assetID), rect(rect) {}
-        Sprite(const Sprite& other) : texture(other.texture), rect(other.rect) {}
+        Sprite(const Sprite& other) : texture(other.texture), rect(other.rect), mask(other.mask) {}
         Sprite& operator=(const Sprite& other)
         {
             if (this != &other)
             {
                 texture = other.texture;
                 rect = other.rect;
+                mask = other.mask;
             }
             return *this;
         }
@@ -36,6 +40,7 @@ namespace Particule::Core
         inline void SetRect(Rect rect)
         {
             this->rect = rect;
+            mask.reset();
         }
         inline void SetRect(int x, int y, int w, int h)
         {
@@ -43,6 +48,7 @@ namespace Particule::Core
             rect.y = y;
             rect.w = w;
             rect.h = h;
+            mask.reset();
         }
 
         FORCE_INLINE Texture* GetTexture()
@@ -60,6 +66,20 @@ namespace Particule::Core
             return rect;
         }
 
+        // Masque 1 bit de la zone (retournée si w ou h est négatif, comme Draw), calculé une seule fois
+        inline const CollisionMask& GetCollisionMask()
+        {
+            if (!mask)
+                mask = std::make_shared<const CollisionMask>(texture.Get(), rect);
+            return *mask;
+        }
+
+        // Collision au pixel près entre ce sprite dessiné en (x, y) et other dessiné en (ox, oy)
+        inline bool Overlaps(int x, int y, Sprite& other, int ox, int oy)
+        {
+            return GetCollisionMask().Overlaps(other.GetCollisionMask(), ox - x, oy - y);
+        }
+
         FORCE_INLINE void Draw(int x, int y)
         {
             //texture->DrawSub(x, y, rect);
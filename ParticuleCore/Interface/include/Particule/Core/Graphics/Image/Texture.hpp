@@ -1,6 +1,7 @@
 #ifndef TEXTURE_HPP
 #define TEXTURE_HPP
 #include <Particule/Core/Graphics/Color.hpp>
+#include <Particule/Core/Graphics/Image/TextureSpan.hpp>
 #include <Particule/Core/Types/Rect.hpp>
 #include <Particule/Core/System/Window.hpp>
 #include <string>
@@ -47,6 +48,10 @@ namespace Particule::Core
         //Unsecure : Don't check if x and y are in the texture and the screen : Faster
         bool PutPixel(int xTexture, int yTexture, int xScreen, int yScreen);
 
+        //Draws a perspective-correct textured span into dst, texture repeated
+        //depth is optional (nullptr : no z-test); transparent texels are skipped
+        void DrawSpan(ColorRaw* dst, uint16_t* depth, int count, const TextureSpan& span);
+
         Sprite* CreateSprite(Rect rect);
 
         static Texture* Load(std::string path);
@@ -0,0 +1,91 @@
+#ifndef TEXTURE_SPAN_HPP
+#define TEXTURE_SPAN_HPP
+
+#include <cstdint>
+
+namespace Particule::Core
+{
+    /*
+    Span horizontal texturé avec correction de perspective, entièrement en entiers.
+
+    Les coordonnées de texture (u, v) sont en texels avec UV_BITS bits de fraction.
+    L'appelant fournit u*q, v*q et q (q proportionnel à 1/z, échelle libre mais > 0) au premier pixel
+    et leurs pas par pixel : ces trois valeurs sont affines à l'écran.
+    Les vraies (u, v) ne sont calculées qu'aux frontières de sous-spans de 2^SUBSPAN_BITS pixels, puis
+    interpolées linéairement à l'intérieur. Sans division 64 bits (appel de bibliothèque sur SH4) : q est
+    ramené à 16 bits significatifs, son inverse vient d'une division 32 bits et u, v de multiplications.
+
+    La profondeur (24.8) n'est utilisée que si un z-buffer 16 bits est fourni à Texture::DrawSpan :
+    un texel n'est écrit que si sa profondeur est strictement supérieure (plus proche) à celle du tampon.
+    */
+    struct TextureSpan
+    {
+        static constexpr int UV_BITS = 12;
+        static constexpr int SUBSPAN_BITS = 4; // 16 pixels
+        static constexpr int DEPTH_BITS = 8;
+
+        int64_t uq = 0, vq = 0, q = 1;
+        int64_t duq = 0, dvq = 0, dq = 0;
+        int32_t depth = 0, ddepth = 0;
+
+        // u = uqi / qi et v = vqi / qi (qi >= 1), arrondis vers zéro comme une division ; erreur relative
+        // de l'ordre de 2^-16 au-delà de 16 bits de q, quotients exacts conservés en deçà
+        static inline void Project(int64_t uqi, int64_t vqi, int64_t qi, int32_t& u, int32_t& v)
+        {
+            int shift = 0;
+            while ((qi >> shift) >= (int64_t(1) << 16)) ++shift;
+            const uint32_t qs = static_cast<uint32_t>(shift ? (qi + (int64_t(1) << (shift - 1))) >> shift : qi);
+            const uint64_t r = uint64_t(0xFFFFFFFFu / qs) + 1; // 2^32 / qs arrondi au-dessus
+            auto scale = [shift, r](int64_t aq) {
+                const uint32_t m = static_cast<uint32_t>((uint64_t(aq < 0 ? -aq : aq) >> shift) * r >> 32);
+                return static_cast<int32_t>(aq < 0 ? 0u - m : m);
+            };
+            u = scale(uqi);
+            v = scale(vqi);
+        }
+
+        // plot(i, u, v, depth) pour chaque pixel i de [0, count)
+        template <typename Plot>
+        inline void Walk(int count, Plot&& plot) const
+        {
+            constexpr int SUB = 1 << SUBSPAN_BITS;
+            int64_t uqi = uq, vqi = vq, qi = q > 0 ? q : 1;
+            int32_t u0, v0;
+            Project(uqi, vqi, qi, u0, v0);
+            int32_t d = depth;
+            for (int x = 0; x < count; )
+            {
+                const int n = count - x < SUB ? count - x : SUB;
+                uqi += duq * n; vqi += dvq * n; qi += dq * n;
+                if (qi < 1) qi = 1; // Extrapolation au-delà du bord : reste fini
+                int32_t u1, v1;
+                Project(uqi, vqi, qi, u1, v1);
+                const int32_t du = n == SUB ? (u1 - u0) >> SUBSPAN_BITS : (u1 - u0) / n;
+                const int32_t dv = n == SUB ? (v1 - v0) >> SUBSPAN_BITS : (v1 - v0) / n;
+                int32_t u = u0, v = v0;
+                for (int i = 0; i < n; ++i)
+                {
+                    plot(x + i, u, v, d);
+                    u += du; v += dv; d += ddepth;
+                }
+                x += n;
+                u0 = u1; v0 = v1;
+            }
+        }
+    };
+
+    // Ramène un texel dans [0, size) (répétition de la texture)
+    template <bool POW2>
+    inline int WrapTexel(int t, int size)
+    {
+        if constexpr (POW2)
+            return t & (size - 1);
+        else
+        {
+            t %= size;
+            return t < 0 ? t + size : t;
+        }
+    }
+}
+
+#endif // TEXTURE_SPAN_HPP
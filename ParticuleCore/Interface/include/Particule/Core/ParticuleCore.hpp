@@ -1,23 +1,29 @@
 #include <Particule/Core/Audio/Audio.hpp>
 #include <Particule/Core/Audio/Sound.hpp>
 #include <Particule/Core/Font/Font.hpp>
+#include <Particule/Core/Graphics/Image/CollisionMask.hpp>
 #include <Particule/Core/Graphics/Image/Sprite.hpp>
 #include <Particule/Core/Graphics/Image/Texture.hpp>
 #include <Particule/Core/Graphics/Shapes/Line.hpp>
 #include <Particule/Core/Graphics/Shapes/Pixel.hpp>
 #include <Particule/Core/Graphics/Shapes/Rect.hpp>
 #include <Particule/Core/Graphics/Color.hpp>
+#include <Particule/Core/Graphics/ColorKernels.hpp>
 #include <Particule/Core/Inputs/Input.hpp>
 #include <Particule/Core/Inputs/Devices.hpp>
 #include <Particule/Core/System/App.hpp>
 #include <Particule/Core/System/Basic.hpp>
 #include <Particule/Core/System/File.hpp>
+#include <Particule/Core/System/JobSystem.hpp>
 //#include <Particule/Core/System/Redefine.hpp>
 #include <Particule/Core/System/Time.hpp>
 #include <Particule/Core/System/Window.hpp>
 #include <Particule/Core/Types/Fixed.hpp>
+#include <Particule/Core/Types/Mat4.hpp>
 #include <Particule/Core/Types/Matrix.hpp>
 #include <Particule/Core/Types/Property.hpp>
+#include <Particule/Core/Types/Quat.hpp>
 #include <Particule/Core/Types/Rect.hpp>
+#include <Particule/Core/Types/VecArray.hpp>
 #include <Particule/Core/Types/Vector2.hpp>
 #include <Particule/Core/Types/Vector3.hpp>
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include <cstdint>
+
+namespace Particule::Core
+{
+    // Travail sur l'intervalle [begin, end[ ; data appartient à l'appelant
+    using JobFunction = void (*)(void* data, uint32_t begin, uint32_t end);
+
+    // Nombre de jobs non terminés ; sert d'attente (JobSystem::Wait) et de dépendance (JobSystem::Run)
+    class JobCounter
+    {
+    public:
+        JobCounter();
+        JobCounter(const JobCounter& other) = delete;
+        JobCounter& operator=(const JobCounter& other) = delete;
+
+        bool done() const;
+    };
+
+    /*
+    Pool de threads à vol de travail : une file par thread, le propriétaire dépile ses derniers jobs,
+    les autres volent les plus anciens. Sans thread disponible (Casio), chaque job est exécuté sur place.
+    */
+    class JobSystem
+    {
+    public:
+        static void Init(uint32_t workers = 0); // 0 : un worker par cœur, moins le thread principal
+        static void Shutdown();
+
+        static uint32_t WorkerCount();  // 0 : exécution sur place
+        static uint32_t ThreadCount();  // workers + threads externes (index 0)
+        static uint32_t ThreadIndex();  // 0 hors worker, 1..WorkerCount() dans un worker
+
+        // Exécute fn(data, begin, end) ; counter incrémenté jusqu'à la fin du job,
+        // dependency : le job ne démarre qu'une fois ce compteur à zéro
+        static void Run(JobFunction fn, void* data, uint32_t begin, uint32_t end,
+                        JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+        // Attend counter en exécutant des jobs en attendant
+        static void Wait(JobCounter& counter);
+
+        // f(begin, end) sur [0, count[ découpé en tranches de grain éléments ; retourne quand tout est fait
+        template <typename F>
+        static void ParallelFor(uint32_t count, uint32_t grain, F&& f);
+    };
+}
+
+#endif // JOBSYSTEM_HPP
@@ -22,6 +22,9 @@ namespace Particule::Core
         void Clear(Color color);
         int Width();
         int Height();
+        // Mémoire vidéo de l'écran (Width() x Height() ColorRaw, ligne par ligne) si la plateforme
+        // permet d'y écrire directement, sinon nullptr ; peut changer d'une frame à l'autre
+        ColorRaw* VideoMemory();
 
         void SetWidth(int width);
         void SetHeight(int height);
@@ -2,10 +2,24 @@
 #define FIXED_H
 #include <limits>
 #include <cstdint>
+#include <cstddef>
 #include <cmath>
 #include <cstring>
 
 #include <Particule/Core/System/Basic.hpp>
+#include <Particule/Core/Types/FixedTables.hpp>
+
+/*
+PARTICULE_FIXED_NO_FLOAT : interdit toute conversion float -> fixed_t à l'exécution.
+Les constructeurs depuis float / double deviennent consteval (seules les constantes passent),
+les opérateurs mixtes fixed_t / flottant sont supprimés. Utiliser les littéraux _fx12 / _fx16
+ou fixed_t::constant() pour les constantes.
+*/
+#ifdef PARTICULE_FIXED_NO_FLOAT
+#define PARTICULE_FIXED_FLOAT_CTOR consteval
+#else
+#define PARTICULE_FIXED_FLOAT_CTOR constexpr
+#endif
 
 namespace Particule::Core
 {
@@ -14,15 +28,44 @@ namespace Particule::Core
         T value;
         static constexpr T FIXED_ONE = static_cast<T>(1) << PRECISION;
 
+        static constexpr int SIN_LUT_BITS = FixedLUT::SinLutBits(PRECISION);
+        static constexpr int ATAN_LUT_BITS = FixedLUT::AtanLutBits(PRECISION);
+        static constexpr int32_t PI_Q16 = 205887;    // pi en Q16
+        static constexpr int32_t PI_2_Q16 = 102944;  // pi / 2 en Q16
+
+        // Radians -> phase 32 bits (2^32 = 2 pi), sans modulo ni flottant
+        static constexpr uint32_t to_phase(T raw) {
+            constexpr int64_t RAD_TO_PHASE = 683565276; // 2^32 / (2 pi)
+            if constexpr (sizeof(T) > 4) {
+                // Réduction modulo 2 pi seulement si le produit ne tiendrait pas dans 64 bits
+                constexpr int64_t LIMIT = std::numeric_limits<int64_t>::max() / RAD_TO_PHASE;
+                constexpr int64_t TWO_PI_RAW = PRECISION >= 30 ? (int64_t(6746518852) << (PRECISION - 30))
+                                                                : ((int64_t(6746518852) + (int64_t(1) << (29 - PRECISION))) >> (30 - PRECISION));
+                if (raw > LIMIT || raw < -LIMIT) raw %= TWO_PI_RAW;
+            }
+            return static_cast<uint32_t>((static_cast<int64_t>(raw) * RAD_TO_PHASE) >> PRECISION);
+        }
+
+        static constexpr fixed_t from_q16(int64_t v) { return fixed_t(FixedLUT::FromQ16<PRECISION, T>(v), true); }
+
     public:
         // Constructors
         constexpr fixed_t() : value(0) {}
         constexpr fixed_t(const fixed_t& other) = default;
         constexpr fixed_t(int v) : value(static_cast<T>(v) << PRECISION) {}
-        constexpr fixed_t(float v) : value(static_cast<T>(v * FIXED_ONE)) {}
-        constexpr fixed_t(double v) : value(static_cast<T>(v * FIXED_ONE)) {}
+        PARTICULE_FIXED_FLOAT_CTOR fixed_t(float v) : value(static_cast<T>(v * FIXED_ONE)) {}
+        PARTICULE_FIXED_FLOAT_CTOR fixed_t(double v) : value(static_cast<T>(v * FIXED_ONE)) {}
         constexpr fixed_t(T raw, bool) : value(raw) {} // raw constructor
 
+        // Constante évaluée à la compilation : arrondi au plus proche, erreur de compilation si hors limites
+        static consteval fixed_t constant(long double v) {
+            const long double scaled = v * FIXED_ONE;
+            if (scaled > static_cast<long double>(std::numeric_limits<T>::max()) ||
+                scaled < static_cast<long double>(std::numeric_limits<T>::min()))
+                throw "fixed_t::constant : valeur hors limites";
+            return fixed_t(static_cast<T>(scaled + (scaled >= 0 ? 0.5L : -0.5L)), true);
+        }
+
         template<int P2, typename T2>
         explicit constexpr fixed_t(const fixed_t<P2, T2>& other) {
             if constexpr (PRECISION > P2) {
@@ -43,8 +86,13 @@ namespace Particule::Core
 
         // Implicit conversions from int, float, double
         constexpr fixed_t& operator=(int v) { value = static_cast<T>(v) << PRECISION; return *this; }
+#ifndef PARTICULE_FIXED_NO_FLOAT
         constexpr fixed_t& operator=(float v) { value = static_cast<T>(v * FIXED_ONE); return *this; }
         constexpr fixed_t& operator=(double v) { value = static_cast<T>(v * FIXED_ONE); return *this; }
+#else
+        fixed_t& operator=(float) = delete;
+        fixed_t& operator=(double) = delete;
+#endif
 
         // Conversion operators
         constexpr operator int() const { return static_cast<int>(value >> PRECISION); }
@@ -78,6 +126,7 @@ namespace Particule::Core
         fixed_t& operator*=(int other) { value = value * other; return *this; }
         fixed_t& operator/=(int other) { value = value / other; return *this; }
 
+#ifndef PARTICULE_FIXED_NO_FLOAT
         // Arithmetic operators with float
         constexpr fixed_t operator+(float other) const { return *this + fixed_t(other); }
         constexpr fixed_t operator-(float other) const { return *this - fixed_t(other); }
@@ -88,6 +137,16 @@ namespace Particule::Core
         fixed_t& operator-=(float other) { *this = *this - fixed_t(other); return *this; }
         fixed_t& operator*=(float other) { *this = *this * fixed_t(other); return *this; }
         fixed_t& operator/=(float other) { *this = *this / fixed_t(other); return *this; }
+#else
+        fixed_t operator+(float) const = delete;
+        fixed_t operator-(float) const = delete;
+        fixed_t operator*(float) const = delete;
+        fixed_t operator/(float) const = delete;
+        fixed_t& operator+=(float) = delete;
+        fixed_t& operator-=(float) = delete;
+        fixed_t& operator*=(float) = delete;
+        fixed_t& operator/=(float) = delete;
+#endif
 
         // Comparison operators with fixed_t
         constexpr bool operator==(const fixed_t& other) const { return value == other.value; }
@@ -105,6 +164,7 @@ namespace Particule::Core
         constexpr bool operator<=(int other) const { return *this <= fixed_t(other); }
         constexpr bool operator>=(int other) const { return *this >= fixed_t(other); }
 
+#ifndef PARTICULE_FIXED_NO_FLOAT
         // Comparison operators with float
         constexpr bool operator==(float other) const { return *this == fixed_t(other); }
         constexpr bool operator!=(float other) const { return *this != fixed_t(other); }
@@ -112,6 +172,14 @@ namespace Particule::Core
         constexpr bool operator>(float other) const { return *this > fixed_t(other); }
         constexpr bool operator<=(float other) const { return *this <= fixed_t(other); }
         constexpr bool operator>=(float other) const { return *this >= fixed_t(other); }
+#else
+        bool operator==(float) const = delete;
+        bool operator!=(float) const = delete;
+        bool operator<(float) const = delete;
+        bool operator>(float) const = delete;
+        bool operator<=(float) const = delete;
+        bool operator>=(float) const = delete;
+#endif
 
         // Utilities
         static constexpr fixed_t from_raw(T raw_val) { return fixed_t(raw_val, true); }
@@ -148,23 +216,16 @@ namespace Particule::Core
             return fixed_t::from_raw(static_cast<T>(res) << (PRECISION / 2));
         }
 
-        // Fast inv sqrt using Quake III method
-        static inline fixed_t inv_sqrt(fixed_t x) {
+        // 1 / sqrt(x), entier uniquement (table de graines + Newton), sature si le résultat dépasse le format
+        static constexpr fixed_t inv_sqrt(fixed_t x) {
             if (x <= fixed_t::zero()) return fixed_t::zero();
-        
-            float xf = static_cast<float>(x);
-            float xhalf = 0.5f * xf;
-        
-            int i;
-            std::memcpy(&i, &xf, sizeof(float));
-            i = 0x5f3759df - (i >> 1);
-            std::memcpy(&xf, &i, sizeof(float));
-        
-            xf = xf * (1.5f - xhalf * xf * xf); // Newton-Raphson iteration
-        
-            return fixed_t(xf);
+            int exponent = 0;
+            const int64_t y = FixedLUT::InvSqrtQ16(static_cast<uint64_t>(x.raw()), PRECISION, exponent);
+            const int shift = PRECISION - 16 + exponent;
+            if (shift < 0) return fixed_t(static_cast<T>(shift > -63 ? y >> -shift : 0), true);
+            if (shift >= 62 || y > (static_cast<int64_t>(std::numeric_limits<T>::max()) >> shift)) return max_value();
+            return fixed_t(static_cast<T>(y << shift), true);
         }
-        
 
         static inline fixed_t inv(fixed_t x) {
             return fixed_t((FIXED_ONE << PRECISION) / x.value, true);
@@ -175,7 +236,7 @@ namespace Particule::Core
         }
 
         static constexpr fixed_t ease(fixed_t x) {
-            return (x <= fixed_t(0.5f)) ? fixed_t(2) * x * x : fixed_t(1) - fixed_t(2) * (fixed_t(1) - x) * (fixed_t(1) - x);
+            return (x <= fixed_t(FIXED_ONE >> 1, true)) ? fixed_t(2) * x * x : fixed_t(1) - fixed_t(2) * (fixed_t(1) - x) * (fixed_t(1) - x);
         }
 
         static constexpr void swap(fixed_t& a, fixed_t& b) {
@@ -184,57 +245,65 @@ namespace Particule::Core
             b = temp;
         }
 
-        static inline fixed_t sin(fixed_t x) {
-            const fixed_t PI     = fixed_t(MY_PI);
-            const fixed_t TWO_PI = fixed_t(2 * MY_PI);
-            x = x + PI;
-            x = fixed_t(x.raw() % TWO_PI.raw(), true);
-            if (x < fixed_t::zero()) x = x + TWO_PI;
-            x = x - PI;
-
-            const fixed_t B = fixed_t(4.0 / MY_PI);
-            const fixed_t C = fixed_t(-4.0 / (MY_PI * MY_PI));
-            const fixed_t P = fixed_t(0.225f);
+        // sin / cos par table quart d'onde (voir FixedTables.hpp), aucun modulo ni multiplication 64 bits par appel
+        static constexpr fixed_t sin(fixed_t x) {
+            return from_q16(FixedLUT::SinQ16<SIN_LUT_BITS>(to_phase(x.value)));
+        }
 
-            fixed_t y = B * x + C * x * x.abs();
-            return P * (y * y.abs() - y) + y;
+        static constexpr fixed_t cos(fixed_t x) {
+            return from_q16(FixedLUT::SinQ16<SIN_LUT_BITS>(to_phase(x.value) + 0x40000000u));
         }
 
-        static inline fixed_t cos(fixed_t x) {
-            return sin(x + fixed_t(MY_PI_2));
+        static constexpr void sincos(fixed_t x, fixed_t& s, fixed_t& c) {
+            const uint32_t phase = to_phase(x.value);
+            s = from_q16(FixedLUT::SinQ16<SIN_LUT_BITS>(phase));
+            c = from_q16(FixedLUT::SinQ16<SIN_LUT_BITS>(phase + 0x40000000u));
         }
 
-        static inline fixed_t atan2(fixed_t y, fixed_t x) {
-            if (x == fixed_t::zero()) return (y > fixed_t::zero() ? fixed_t(MY_PI_2) : (y < fixed_t::zero() ? fixed_t(-MY_PI_2) : fixed_t::zero()));
+        // Versions par lots : out[i] = sin(angles[i]) (out peut être angles)
+        static inline void sin_span(const fixed_t* angles, fixed_t* out, size_t count) {
+            for (size_t i = 0; i < count; ++i)
+                out[i] = from_q16(FixedLUT::SinQ16<SIN_LUT_BITS>(to_phase(angles[i].value)));
+        }
 
-            fixed_t abs_y = y.abs();
-            fixed_t angle;
+        static inline void cos_span(const fixed_t* angles, fixed_t* out, size_t count) {
+            for (size_t i = 0; i < count; ++i)
+                out[i] = from_q16(FixedLUT::SinQ16<SIN_LUT_BITS>(to_phase(angles[i].value) + 0x40000000u));
+        }
 
-            if (x.abs() > abs_y) {
-                fixed_t r = abs_y / x.abs();
-                fixed_t r2 = r * r;
-                angle = r * fixed_t(0.97239411f) - r * r2 * fixed_t(0.19194795f);
-            } else {
-                fixed_t r = x.abs() / abs_y;
-                fixed_t r2 = r * r;
-                angle = fixed_t(MY_PI_2) - (r * fixed_t(0.97239411f) - r * r2 * fixed_t(0.19194795f));
-            }
+        // out[i] = sin(start + i * step) : une seule conversion, puis accumulation de phase (LFO, oscillateurs)
+        static inline void sin_ramp(fixed_t start, fixed_t step, fixed_t* out, size_t count) {
+            uint32_t phase = to_phase(start.value);
+            const uint32_t dphase = to_phase(step.value);
+            for (size_t i = 0; i < count; ++i, phase += dphase)
+                out[i] = from_q16(FixedLUT::SinQ16<SIN_LUT_BITS>(phase));
+        }
 
-            if (x < fixed_t::zero()) {
-                angle = (y < fixed_t::zero()) ? angle - fixed_t(MY_PI) : fixed_t(MY_PI) - angle;
-            } else {
-                if (y < fixed_t::zero()) angle = -angle;
-            }
+        // atan2 par octant : table de atan(min / max) puis symétries
+        static constexpr fixed_t atan2(fixed_t y, fixed_t x) {
+            if (x.value == 0 && y.value == 0) return fixed_t::zero();
+            const uint64_t ax = static_cast<uint64_t>(x.value < 0 ? -static_cast<int64_t>(x.value) : static_cast<int64_t>(x.value));
+            const uint64_t ay = static_cast<uint64_t>(y.value < 0 ? -static_cast<int64_t>(y.value) : static_cast<int64_t>(y.value));
+            int32_t angle = ax >= ay
+                ? FixedLUT::AtanOctantQ16<ATAN_LUT_BITS>(ay, ax)
+                : PI_2_Q16 - FixedLUT::AtanOctantQ16<ATAN_LUT_BITS>(ax, ay);
+            if (x.value < 0) angle = PI_Q16 - angle;
+            if (y.value < 0) angle = -angle;
+            return from_q16(angle);
+        }
 
-            return angle;
+        // atan2 par lots : out[i] = atan2(y[i], x[i])
+        static inline void atan2_span(const fixed_t* y, const fixed_t* x, fixed_t* out, size_t count) {
+            for (size_t i = 0; i < count; ++i)
+                out[i] = atan2(y[i], x[i]);
         }
 
         static inline fixed_t asin(fixed_t x) {
-            if (x < fixed_t(-1.0f)) x = fixed_t(-1.0f);
-            if (x > fixed_t(1.0f)) x = fixed_t(1.0f);
+            if (x < -one()) x = -one();
+            if (x > one()) x = one();
 
-            const fixed_t a = fixed_t(0.165f);
-            const fixed_t b = fixed_t(0.007f);
+            constexpr fixed_t a = constant(0.165L);
+            constexpr fixed_t b = constant(0.007L);
             fixed_t x3 = x * x * x;
             fixed_t x5 = x3 * x * x;
 
@@ -261,6 +330,7 @@ namespace Particule::Core
     template<int P, typename T> constexpr fixed_t<P,T> operator*(int lhs, const fixed_t<P,T>& rhs) { return fixed_t<P,T>(lhs) * rhs; }
     template<int P, typename T> constexpr fixed_t<P,T> operator/(int lhs, const fixed_t<P,T>& rhs) { return fixed_t<P,T>(lhs) / rhs; }
 
+#ifndef PARTICULE_FIXED_NO_FLOAT
     // float op fixed_t
     template<int P, typename T> constexpr fixed_t<P,T> operator+(float lhs, const fixed_t<P,T>& rhs) { return fixed_t<P,T>(lhs) + rhs; }
     template<int P, typename T> constexpr fixed_t<P,T> operator-(float lhs, const fixed_t<P,T>& rhs) { return fixed_t<P,T>(lhs) - rhs; }
@@ -272,12 +342,23 @@ namespace Particule::Core
     template<int P, typename T> constexpr fixed_t<P,T> operator-(double lhs, const fixed_t<P,T>& rhs) { return fixed_t<P,T>(lhs) - rhs; }
     template<int P, typename T> constexpr fixed_t<P,T> operator*(double lhs, const fixed_t<P,T>& rhs) { return fixed_t<P,T>(lhs) * rhs; }
     template<int P, typename T> constexpr fixed_t<P,T> operator/(double lhs, const fixed_t<P,T>& rhs) { return fixed_t<P,T>(lhs) / rhs; }
+#else
+    template<int P, typename T> fixed_t<P,T> operator+(float, const fixed_t<P,T>&) = delete;
+    template<int P, typename T> fixed_t<P,T> operator-(float, const fixed_t<P,T>&) = delete;
+    template<int P, typename T> fixed_t<P,T> operator*(float, const fixed_t<P,T>&) = delete;
+    template<int P, typename T> fixed_t<P,T> operator/(float, const fixed_t<P,T>&) = delete;
+    template<int P, typename T> fixed_t<P,T> operator+(double, const fixed_t<P,T>&) = delete;
+    template<int P, typename T> fixed_t<P,T> operator-(double, const fixed_t<P,T>&) = delete;
+    template<int P, typename T> fixed_t<P,T> operator*(double, const fixed_t<P,T>&) = delete;
+    template<int P, typename T> fixed_t<P,T> operator/(double, const fixed_t<P,T>&) = delete;
+#endif
     //surcharge d'opérateurs sqrt, sin, cos, atan2, asin
     template<int P, typename T> inline fixed_t<P,T> sqrt(const fixed_t<P,T>& x) { return fixed_t<P,T>::sqrt(x); }
     template<int P, typename T> inline fixed_t<P,T> sin(const fixed_t<P,T>& x) { return fixed_t<P,T>::sin(x); }
     template<int P, typename T> inline fixed_t<P,T> cos(const fixed_t<P,T>& x) { return fixed_t<P,T>::cos(x); }
     template<int P, typename T> inline fixed_t<P,T> atan2(const fixed_t<P,T>& y, const fixed_t<P,T>& x) { return fixed_t<P,T>::atan2(y, x); }
     template<int P, typename T> inline fixed_t<P,T> asin(const fixed_t<P,T>& x) { return fixed_t<P,T>::asin(x); }
+    template<int P, typename T> inline fixed_t<P,T> inv_sqrt(const fixed_t<P,T>& x) { return fixed_t<P,T>::inv_sqrt(x); }
 
 
     using fixed12_32 = fixed_t<12, int32_t>;
@@ -286,6 +367,15 @@ namespace Particule::Core
     using fixed16_64 = fixed_t<16, int64_t>;
     using fixed18_32 = fixed_t<18, int32_t>;
     using fixed18_64 = fixed_t<18, int64_t>;
+
+    // Littéraux évalués à la compilation : 1.5_fx12, 0.225_fx16 (aucun code flottant généré)
+    inline namespace literals
+    {
+        consteval fixed12_32 operator""_fx12(long double v) { return fixed12_32::constant(v); }
+        consteval fixed12_32 operator""_fx12(unsigned long long v) { return fixed12_32::constant(static_cast<long double>(v)); }
+        consteval fixed16_32 operator""_fx16(long double v) { return fixed16_32::constant(v); }
+        consteval fixed16_32 operator""_fx16(unsigned long long v) { return fixed16_32::constant(static_cast<long double>(v)); }
+    }
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,194 @@
+#ifndef FIXED_TABLES_HPP
+#define FIXED_TABLES_HPP
+#include <cstdint>
+#include <cstddef>
+
+/*
+Tables de trigonométrie et de racine inverse pour fixed_t, générées à la compilation (constexpr).
+Les flottants n'apparaissent que dans la génération des tables : aucun calcul flottant à l'exécution.
+
+Toutes les valeurs sont en Q16 (1.0 = 65536) et converties vers la précision du fixed_t par décalage.
+Les angles sont des "phases" 32 bits : un tour complet = 2^32, ce qui rend le modulo gratuit.
+
+La taille des tables est réglable par précision (voir SinLutBits / AtanLutBits) ou forcée par
+PARTICULE_FIXED_SIN_LUT_BITS / PARTICULE_FIXED_ATAN_LUT_BITS.
+*/
+
+namespace Particule::Core::FixedLUT
+{
+    namespace detail
+    {
+        constexpr double PI = 3.14159265358979323846;
+
+        constexpr double SinSeries(double x) // x dans [0, pi / 2]
+        {
+            double term = x, sum = x;
+            for (int n = 1; n < 16; ++n)
+            {
+                term *= -x * x / ((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double Sqrt(double x)
+        {
+            if (x <= 0) return 0;
+            double r = x > 1 ? x : 1;
+            for (int i = 0; i < 64; ++i)
+                r = 0.5 * (r + x / r);
+            return r;
+        }
+
+        constexpr double AtanSeries(double x) // x dans [0, 1]
+        {
+            // Deux réductions atan(x) = 2 atan(x / (1 + sqrt(1 + x^2))) : |x| <= 0.2
+            x = x / (1 + Sqrt(1 + x * x));
+            x = x / (1 + Sqrt(1 + x * x));
+            double term = x, sum = x;
+            for (int n = 1; n < 24; ++n)
+            {
+                term *= -x * x;
+                sum += term / (2 * n + 1);
+            }
+            return 4 * sum;
+        }
+
+        constexpr int32_t RoundQ16(double v)
+        {
+            return static_cast<int32_t>(v * 65536.0 + (v >= 0 ? 0.5 : -0.5));
+        }
+    }
+
+    // Quart d'onde de sinus : SIZE + 1 valeurs sur [0, pi / 2] (la dernière sert à l'interpolation)
+    template <int BITS>
+    struct SinTable
+    {
+        static constexpr int SIZE = 1 << BITS;
+        int32_t values[SIZE + 1];
+
+        constexpr SinTable() : values{}
+        {
+            for (int i = 0; i <= SIZE; ++i)
+                values[i] = detail::RoundQ16(detail::SinSeries(detail::PI / 2 * i / SIZE));
+        }
+    };
+
+    // atan(r) pour r = min / max dans [0, 1] : un octant
+    template <int BITS>
+    struct AtanTable
+    {
+        static constexpr int SIZE = 1 << BITS;
+        int32_t values[SIZE + 1];
+
+        constexpr AtanTable() : values{}
+        {
+            for (int i = 0; i <= SIZE; ++i)
+                values[i] = detail::RoundQ16(detail::AtanSeries(static_cast<double>(i) / SIZE));
+        }
+    };
+
+    // Graine de 1/sqrt(m) pour m dans [1, 4), indexée par les 6 bits de poids fort de m en Q30
+    struct InvSqrtTable
+    {
+        int32_t values[48];
+
+        constexpr InvSqrtTable() : values{}
+        {
+            for (int i = 0; i < 48; ++i)
+                values[i] = detail::RoundQ16(1.0 / detail::Sqrt((i + 16 + 0.5) / 16.0));
+        }
+    };
+
+    constexpr int SinLutBits(int precision)
+    {
+#ifdef PARTICULE_FIXED_SIN_LUT_BITS
+        (void)precision;
+        return PARTICULE_FIXED_SIN_LUT_BITS;
+#else
+        return precision <= 12 ? 8 : 10;
+#endif
+    }
+
+    constexpr int AtanLutBits(int precision)
+    {
+#ifdef PARTICULE_FIXED_ATAN_LUT_BITS
+        (void)precision;
+        return PARTICULE_FIXED_ATAN_LUT_BITS;
+#else
+        return precision <= 12 ? 7 : 9;
+#endif
+    }
+
+    template <int BITS> inline constexpr SinTable<BITS> SIN{};
+    template <int BITS> inline constexpr AtanTable<BITS> ATAN{};
+    inline constexpr InvSqrtTable INV_SQRT{};
+
+    // sin(phase) en Q16, phase sur 32 bits (2^32 = 2 pi), interpolation linéaire entre deux entrées
+    template <int BITS>
+    constexpr int32_t SinQ16(uint32_t phase)
+    {
+        constexpr int FRAC = 30 - BITS;
+        const uint32_t quadrant = phase >> 30;
+        uint32_t pos = phase & 0x3FFFFFFFu;
+        if (quadrant & 1) pos = 0x40000000u - pos;
+        const uint32_t index = pos >> FRAC;
+        const int32_t f = static_cast<int32_t>((pos & ((1u << FRAC) - 1)) >> (FRAC > 16 ? FRAC - 16 : 0)) << (FRAC < 16 ? 16 - FRAC : 0);
+        const int32_t* t = SIN<BITS>.values;
+        const int32_t a = t[index];
+        const int32_t v = index < static_cast<uint32_t>(SinTable<BITS>::SIZE)
+            ? a + static_cast<int32_t>((static_cast<int64_t>(t[index + 1] - a) * f) >> 16)
+            : a;
+        return (quadrant & 2) ? -v : v;
+    }
+
+    // atan(num / den) en Q16 pour 0 <= num <= den, den > 0
+    template <int BITS>
+    constexpr int32_t AtanOctantQ16(uint64_t num, uint64_t den)
+    {
+        constexpr int SIZE = AtanTable<BITS>::SIZE;
+        // r en Q(BITS + 16) : index sur BITS bits, 16 bits d'interpolation
+        while (num >= (uint64_t(1) << 40)) { num >>= 1; den >>= 1; }
+        if (den == 0) return 0;
+        const uint64_t r = (num << (BITS + 16)) / den;
+        const uint32_t index = static_cast<uint32_t>(r >> 16);
+        const int32_t f = static_cast<int32_t>(r & 0xFFFF);
+        const int32_t* t = ATAN<BITS>.values;
+        if (index >= static_cast<uint32_t>(SIZE)) return t[SIZE];
+        return t[index] + static_cast<int32_t>((static_cast<int64_t>(t[index + 1] - t[index]) * f) >> 16);
+    }
+
+    // 1/sqrt(raw / 2^precision) en Q16 pour raw > 0, entier uniquement (graine tabulée + deux itérations de Newton)
+    // exponent reçoit le décalage binaire e : résultat réel = valeur Q16 * 2^e
+    constexpr int32_t InvSqrtQ16(uint64_t raw, int precision, int& exponent)
+    {
+        int msb = 63;
+        while (msb > 0 && !((raw >> msb) & 1)) --msb;
+        // m = raw * 2^k dans [2^30, 2^32) avec (30 - k - precision) pair
+        int k = 30 - msb;
+        if (((30 - k - precision) & 1) != 0) ++k;
+        const uint64_t m = k >= 0 ? raw << k : raw >> -k;
+
+        // Newton en Q30 : y = y * (3 - m * y^2) / 2
+        uint64_t y = static_cast<uint64_t>(INV_SQRT.values[(m >> 26) - 16]) << 14;
+        for (int i = 0; i < 2; ++i)
+        {
+            const uint64_t my2 = (m * ((y * y) >> 30)) >> 30;
+            y = (y * ((uint64_t(3) << 30) - my2)) >> 31;
+        }
+        exponent = -(30 - k - precision) / 2;
+        return static_cast<int32_t>(y >> 14);
+    }
+
+    // Convertit une valeur Q16 vers une précision quelconque
+    template <int PRECISION, typename T>
+    constexpr T FromQ16(int64_t v)
+    {
+        if constexpr (PRECISION >= 16)
+            return static_cast<T>(v << (PRECISION - 16));
+        else
+            return static_cast<T>(v >> (16 - PRECISION));
+    }
+}
+
+#endif // FIXED_TABLES_HPP
@@ -0,0 +1,162 @@
+#ifndef MAT4_HPP
+#define MAT4_HPP
+#include <cstddef>
+#include <cstdint>
+#include <Particule/Core/System/Basic.hpp>
+#include <Particule/Core/Types/Fixed.hpp>
+#include <Particule/Core/Types/Vector3.hpp>
+#include <Particule/Core/Types/Quat.hpp>
+
+namespace Particule::Core
+{
+    // Matrice 4x4, m[ligne][colonne], vecteurs colonnes : v' = M * v
+    template <typename T>
+    class Mat4 {
+    public:
+        T m[4][4]{};
+
+        constexpr Mat4() = default;
+
+        static constexpr Mat4 identity() {
+            Mat4 r;
+            r.m[0][0] = T(1); r.m[1][1] = T(1); r.m[2][2] = T(1); r.m[3][3] = T(1);
+            return r;
+        }
+
+        static constexpr Mat4 translate(const Vector3<T>& t) {
+            Mat4 r = identity();
+            r.m[0][3] = t.x; r.m[1][3] = t.y; r.m[2][3] = t.z;
+            return r;
+        }
+
+        static constexpr Mat4 scale(const Vector3<T>& s) {
+            Mat4 r;
+            r.m[0][0] = s.x; r.m[1][1] = s.y; r.m[2][2] = s.z; r.m[3][3] = T(1);
+            return r;
+        }
+
+        static constexpr Mat4 rotate(const Quat<T>& q) {
+            const T xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+            const T xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+            const T wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+            Mat4 r;
+            r.m[0][0] = T(1) - (yy + zz) * T(2); r.m[0][1] = (xy - wz) * T(2);         r.m[0][2] = (xz + wy) * T(2);
+            r.m[1][0] = (xy + wz) * T(2);         r.m[1][1] = T(1) - (xx + zz) * T(2); r.m[1][2] = (yz - wx) * T(2);
+            r.m[2][0] = (xz - wy) * T(2);         r.m[2][1] = (yz + wx) * T(2);         r.m[2][2] = T(1) - (xx + yy) * T(2);
+            r.m[3][3] = T(1);
+            return r;
+        }
+
+        // Translation * Rotation * Echelle, sans multiplication de matrices complètes
+        static constexpr Mat4 trs(const Vector3<T>& t, const Quat<T>& q, const Vector3<T>& s) {
+            Mat4 r = rotate(q);
+            for (int i = 0; i < 3; ++i) {
+                r.m[i][0] = r.m[i][0] * s.x;
+                r.m[i][1] = r.m[i][1] * s.y;
+                r.m[i][2] = r.m[i][2] * s.z;
+            }
+            r.m[0][3] = t.x; r.m[1][3] = t.y; r.m[2][3] = t.z;
+            return r;
+        }
+
+        constexpr Mat4 operator*(const Mat4& o) const {
+            Mat4 r;
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    r.m[i][j] = m[i][0] * o.m[0][j] + m[i][1] * o.m[1][j] + m[i][2] * o.m[2][j] + m[i][3] * o.m[3][j];
+            return r;
+        }
+
+        constexpr Vector3<T> multiplyPoint(const Vector3<T>& v) const {
+            return { m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z + m[0][3],
+                     m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z + m[1][3],
+                     m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z + m[2][3] };
+        }
+
+        constexpr Vector3<T> multiplyVector(const Vector3<T>& v) const {
+            return { m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+                     m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                     m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z };
+        }
+
+        constexpr Vector3<T> getPosition() const { return { m[0][3], m[1][3], m[2][3] }; }
+
+        constexpr Mat4 transposed() const {
+            Mat4 r;
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    r.m[i][j] = m[j][i];
+            return r;
+        }
+
+        // Inverse d'une matrice affine (dernière ligne = 0 0 0 1)
+        constexpr Mat4 inverseAffine() const {
+            const T c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+            const T c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+            const T c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+            const T det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+            if (det == T(0)) return identity();
+            Mat4 r;
+            r.m[0][0] = c00 / det;
+            r.m[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) / det;
+            r.m[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) / det;
+            r.m[1][0] = c01 / det;
+            r.m[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) / det;
+            r.m[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) / det;
+            r.m[2][0] = c02 / det;
+            r.m[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) / det;
+            r.m[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) / det;
+            const Vector3<T> t = getPosition();
+            for (int i = 0; i < 3; ++i)
+                r.m[i][3] = -(r.m[i][0] * t.x + r.m[i][1] * t.y + r.m[i][2] * t.z);
+            r.m[3][3] = T(1);
+            return r;
+        }
+    };
+
+    /*
+    Transformation par lots de sommets en structure de tableaux (SoA), sur les valeurs raw.
+    Une seule passe, sans surcharge d'opérateur par composante : la boucle est vectorisable
+    par le compilateur sur hôte (SSE4.1 / AVX2 / NEON) et reste en entiers sur SH4.
+    Les tableaux d'entrée et de sortie ne doivent pas se chevaucher.
+    */
+    template <int P, typename R>
+    inline void TransformPoints(const Mat4<fixed_t<P, R>>& mat,
+                                const R* __restrict x, const R* __restrict y, const R* __restrict z, std::size_t count,
+                                R* __restrict outX, R* __restrict outY, R* __restrict outZ)
+    {
+        const int64_t m00 = mat.m[0][0].raw(), m01 = mat.m[0][1].raw(), m02 = mat.m[0][2].raw();
+        const int64_t m10 = mat.m[1][0].raw(), m11 = mat.m[1][1].raw(), m12 = mat.m[1][2].raw();
+        const int64_t m20 = mat.m[2][0].raw(), m21 = mat.m[2][1].raw(), m22 = mat.m[2][2].raw();
+        const int64_t t0 = static_cast<int64_t>(mat.m[0][3].raw()) << P;
+        const int64_t t1 = static_cast<int64_t>(mat.m[1][3].raw()) << P;
+        const int64_t t2 = static_cast<int64_t>(mat.m[2][3].raw()) << P;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const int64_t vx = x[i], vy = y[i], vz = z[i];
+            outX[i] = static_cast<R>((m00 * vx + m01 * vy + m02 * vz + t0) >> P);
+            outY[i] = static_cast<R>((m10 * vx + m11 * vy + m12 * vz + t1) >> P);
+            outZ[i] = static_cast<R>((m20 * vx + m21 * vy + m22 * vz + t2) >> P);
+        }
+    }
+
+    // Comme TransformPoints sans la translation (normales, directions)
+    template <int P, typename R>
+    inline void TransformDirections(const Mat4<fixed_t<P, R>>& mat,
+                                    const R* __restrict x, const R* __restrict y, const R* __restrict z, std::size_t count,
+                                    R* __restrict outX, R* __restrict outY, R* __restrict outZ)
+    {
+        const int64_t m00 = mat.m[0][0].raw(), m01 = mat.m[0][1].raw(), m02 = mat.m[0][2].raw();
+        const int64_t m10 = mat.m[1][0].raw(), m11 = mat.m[1][1].raw(), m12 = mat.m[1][2].raw();
+        const int64_t m20 = mat.m[2][0].raw(), m21 = mat.m[2][1].raw(), m22 = mat.m[2][2].raw();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const int64_t vx = x[i], vy = y[i], vz = z[i];
+            outX[i] = static_cast<R>((m00 * vx + m01 * vy + m02 * vz) >> P);
+            outY[i] = static_cast<R>((m10 * vx + m11 * vy + m12 * vz) >> P);
+            outZ[i] = static_cast<R>((m20 * vx + m21 * vy + m22 * vz) >> P);
+        }
+    }
+}
+
+#endif // MAT4_HPP
@@ -7,11 +7,177 @@
 #include <type_traits>
 #include <cassert>
 #include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <utility>
 
 namespace Particule::Core {
 
-    template <class T>
+    /*
+    Matrix<T>          : dimensions choisies à l'exécution (std::vector).
+    Matrix<T, Dims...> : dimensions fixées à la compilation, stockage inline, index = somme i * pas constant.
+    MatrixView<T, Dims...> : mêmes accès sur un tampon fourni par l'appelant (ou une tranche d'une matrice).
+    */
+    template <class T, std::size_t... Dims>
+    class Matrix;
+
+    template <class T, std::size_t... Dims>
+    class MatrixView;
+
+    namespace detail {
+
+        template <std::size_t... Dims>
+        struct StaticExtents {
+            static constexpr std::size_t RANK = sizeof...(Dims);
+            static constexpr std::array<std::size_t, RANK> DIMS = { Dims... };
+            static constexpr std::size_t SIZE = (Dims * ... * 1);
+
+            static constexpr std::array<std::size_t, RANK> make_strides() noexcept {
+                std::array<std::size_t, RANK> s{};
+                std::size_t acc = 1;
+                for (std::size_t i = RANK; i-- > 0; ) { s[i] = acc; acc *= DIMS[i]; }
+                return s;
+            }
+            static constexpr std::array<std::size_t, RANK> STRIDES = make_strides();
+
+            template <std::size_t... K, class... Idx>
+            static FORCE_INLINE constexpr std::size_t offset_impl(std::index_sequence<K...>, Idx... idxs) noexcept {
+                assert(((static_cast<std::size_t>(idxs) < DIMS[K]) && ...) && "index out of bounds");
+                return ((static_cast<std::size_t>(idxs) * STRIDES[K]) + ... + 0);
+            }
+
+            template <class... Idx>
+            static FORCE_INLINE constexpr std::size_t offset(Idx... idxs) noexcept {
+                static_assert(sizeof...(Idx) == RANK, "bad number of indices");
+                static_assert(std::conjunction_v<std::is_integral<Idx>...>, "indices must be integral");
+                return offset_impl(std::make_index_sequence<RANK>{}, idxs...);
+            }
+        };
+
+        // Vue sur la tranche d'indice i de la première dimension
+        template <class T, std::size_t D0, std::size_t... Rest>
+        struct SliceOf { using type = MatrixView<T, Rest...>; };
+    }
+
+    template <class T, std::size_t... Dims>
+    class MatrixView {
+        static_assert(sizeof...(Dims) >= 1, "MatrixView needs at least one dimension");
+        using Ext = detail::StaticExtents<Dims...>;
+        T* data_ = nullptr;
+
+    public:
+        using value_type = T;
+        static constexpr std::size_t RANK = Ext::RANK;
+        static constexpr std::size_t SIZE = Ext::SIZE;
+
+        constexpr MatrixView() = default;
+        constexpr explicit MatrixView(T* buffer) noexcept : data_(buffer) {} // SIZE éléments, row-major
+
+        [[nodiscard]] static constexpr std::size_t rank() noexcept { return RANK; }
+        [[nodiscard]] static constexpr std::size_t dim(std::size_t i) noexcept { return Ext::DIMS[i]; }
+        [[nodiscard]] static constexpr std::size_t stride(std::size_t i) noexcept { return Ext::STRIDES[i]; }
+        [[nodiscard]] static constexpr std::size_t total_size() noexcept { return SIZE; }
+
+        template <class... Idx>
+        FORCE_INLINE constexpr T& operator()(Idx... idxs) const noexcept { return data_[Ext::offset(idxs...)]; }
+        template <class... Idx>
+        FORCE_INLINE constexpr T& get(Idx... idxs) const noexcept { return data_[Ext::offset(idxs...)]; }
+        template <class... Idx>
+        FORCE_INLINE constexpr void set(const T& v, Idx... idxs) const noexcept { data_[Ext::offset(idxs...)] = v; }
+
+        // Rang 1 : accès direct
+        FORCE_INLINE constexpr T& operator[](std::size_t i) const noexcept {
+            static_assert(RANK == 1, "operator[] is only available on rank 1 views, use slice()");
+            assert(i < SIZE && "index out of bounds");
+            return data_[i];
+        }
+
+        // Tranche i de la première dimension : ligne d'une grille 2D, plan d'une grille 3D
+        [[nodiscard]] FORCE_INLINE constexpr auto slice(std::size_t i) const noexcept {
+            static_assert(RANK >= 2, "slice() needs rank >= 2");
+            assert(i < Ext::DIMS[0] && "index out of bounds");
+            return typename detail::SliceOf<T, Dims...>::type(data_ + i * Ext::STRIDES[0]);
+        }
+
+        // f(MatrixView<T, Last>) pour chaque ligne (dernière dimension), dans l'ordre mémoire
+        template <class F>
+        FORCE_INLINE constexpr void for_each_row(F&& f) const {
+            constexpr std::size_t LAST = Ext::DIMS[RANK - 1];
+            for (std::size_t off = 0; off < SIZE; off += LAST)
+                f(MatrixView<T, LAST>(data_ + off));
+        }
+
+        FORCE_INLINE constexpr void fill(const T& v) const { std::fill(data_, data_ + SIZE, v); }
+        FORCE_INLINE constexpr void copy_from(MatrixView<const std::remove_const_t<T>, Dims...> src) const {
+            std::copy(src.begin(), src.end(), data_);
+        }
+
+        [[nodiscard]] FORCE_INLINE constexpr T* data() const noexcept { return data_; }
+        [[nodiscard]] FORCE_INLINE constexpr T* begin() const noexcept { return data_; }
+        [[nodiscard]] FORCE_INLINE constexpr T* end() const noexcept { return data_ + SIZE; }
+
+        constexpr operator MatrixView<const T, Dims...>() const noexcept requires (!std::is_const_v<T>) {
+            return MatrixView<const T, Dims...>(data_);
+        }
+    };
+
+    // Dimensions fixes, stockage inline (pas d'allocation) : Matrix<uint8_t, 32, 64> grille;
+    template <class T, std::size_t... Dims>
     class Matrix {
+        using Ext = detail::StaticExtents<Dims...>;
+        T data_[Ext::SIZE]{};
+
+    public:
+        using value_type = T;
+        using view_type = MatrixView<T, Dims...>;
+        using const_view_type = MatrixView<const T, Dims...>;
+        static constexpr std::size_t RANK = Ext::RANK;
+        static constexpr std::size_t SIZE = Ext::SIZE;
+
+        constexpr Matrix() = default;
+        constexpr explicit Matrix(const T& v) { fill(v); }
+
+        [[nodiscard]] static constexpr std::size_t rank() noexcept { return RANK; }
+        [[nodiscard]] static constexpr std::size_t dim(std::size_t i) noexcept { return Ext::DIMS[i]; }
+        [[nodiscard]] static constexpr std::size_t stride(std::size_t i) noexcept { return Ext::STRIDES[i]; }
+        [[nodiscard]] static constexpr std::size_t total_size() noexcept { return SIZE; }
+
+        [[nodiscard]] FORCE_INLINE constexpr view_type view() noexcept { return view_type(data_); }
+        [[nodiscard]] FORCE_INLINE constexpr const_view_type view() const noexcept { return const_view_type(data_); }
+
+        template <class... Idx>
+        FORCE_INLINE constexpr T& operator()(Idx... idxs) noexcept { return data_[Ext::offset(idxs...)]; }
+        template <class... Idx>
+        FORCE_INLINE constexpr const T& operator()(Idx... idxs) const noexcept { return data_[Ext::offset(idxs...)]; }
+        template <class... Idx>
+        FORCE_INLINE constexpr T& get(Idx... idxs) noexcept { return data_[Ext::offset(idxs...)]; }
+        template <class... Idx>
+        FORCE_INLINE constexpr const T& get(Idx... idxs) const noexcept { return data_[Ext::offset(idxs...)]; }
+        template <class... Idx>
+        FORCE_INLINE constexpr void set(const T& v, Idx... idxs) noexcept { data_[Ext::offset(idxs...)] = v; }
+
+        [[nodiscard]] FORCE_INLINE constexpr auto slice(std::size_t i) noexcept { return view().slice(i); }
+        [[nodiscard]] FORCE_INLINE constexpr auto slice(std::size_t i) const noexcept { return view().slice(i); }
+
+        template <class F>
+        FORCE_INLINE constexpr void for_each_row(F&& f) { view().for_each_row(static_cast<F&&>(f)); }
+        template <class F>
+        FORCE_INLINE constexpr void for_each_row(F&& f) const { view().for_each_row(static_cast<F&&>(f)); }
+
+        FORCE_INLINE constexpr void fill(const T& v) { std::fill(data_, data_ + SIZE, v); }
+        FORCE_INLINE constexpr void copy_from(const_view_type src) { std::copy(src.begin(), src.end(), data_); }
+
+        [[nodiscard]] FORCE_INLINE constexpr T* data() noexcept { return data_; }
+        [[nodiscard]] FORCE_INLINE constexpr const T* data() const noexcept { return data_; }
+        [[nodiscard]] FORCE_INLINE constexpr T* begin() noexcept { return data_; }
+        [[nodiscard]] FORCE_INLINE constexpr T* end() noexcept { return data_ + SIZE; }
+        [[nodiscard]] FORCE_INLINE constexpr const T* begin() const noexcept { return data_; }
+        [[nodiscard]] FORCE_INLINE constexpr const T* end() const noexcept { return data_ + SIZE; }
+    };
+
+    // Dimensions choisies à l'exécution
+    template <class T>
+    class Matrix<T> {
     std::vector<std::size_t> dims_;     // tailles par dimension
     std::vector<std::size_t> strides_;  // pas par dimension (layout row-major)
     std::vector<T>           data_;     // stockage contigu
@@ -121,6 +287,13 @@ Matrix<int> m(20,20,3);
 m.set(42, 1,2,0);
 int a = m.get(1,2,0);
 int b = m(1,2,0); // même chose
+
+Matrix<uint8_t, 16, 32> tiles;      // 16 lignes de 32 cases, sans allocation
+tiles(3, 5) = 1;                    // offset = 3 * 32 + 5, pas constants
+tiles.slice(3).fill(0);             // ligne 3
+uint8_t buffer[16 * 32];
+MatrixView<uint8_t, 16, 32> view(buffer);
+view.copy_from(tiles.view());
 */
 
 #endif // MATRIX_HPP
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef QUAT_HPP
+#define QUAT_HPP
+#include <cmath>
+#include <Particule/Core/Types/Vector3.hpp>
+
+namespace Particule::Core
+{
+    // Quaternion unitaire (x, y, z, w), pensé pour T = fixed_t mais utilisable avec float
+    template <typename T>
+    class Quat {
+    public:
+        T x, y, z, w;
+
+        constexpr Quat() : x(0), y(0), z(0), w(1) {}
+        constexpr Quat(T X, T Y, T Z, T W) : x(X), y(Y), z(Z), w(W) {}
+
+        static constexpr Quat identity() { return Quat(); }
+
+        // axis doit être normalisé, angle en radians
+        static Quat axisAngle(const Vector3<T>& axis, T angle) {
+            using std::sin; using std::cos;
+            const T half = angle / 2;
+            const T s = sin(half);
+            return Quat(axis.x * s, axis.y * s, axis.z * s, cos(half));
+        }
+
+        // Angles d'Euler en radians, appliqués dans l'ordre Z, X puis Y (comme Transform)
+        static Quat fromEuler(const Vector3<T>& euler) {
+            using std::sin; using std::cos;
+            const T hx = euler.x / 2, hy = euler.y / 2, hz = euler.z / 2;
+            const Quat qx(sin(hx), T(0), T(0), cos(hx));
+            const Quat qy(T(0), sin(hy), T(0), cos(hy));
+            const Quat qz(T(0), T(0), sin(hz), cos(hz));
+            return qy * qx * qz;
+        }
+
+        // Composition : (a * b).rotate(v) == a.rotate(b.rotate(v))
+        constexpr Quat operator*(const Quat& q) const {
+            return Quat(w * q.x + x * q.w + y * q.z - z * q.y,
+                        w * q.y - x * q.z + y * q.w + z * q.x,
+                        w * q.z + x * q.y - y * q.x + z * q.w,
+                        w * q.w - x * q.x - y * q.y - z * q.z);
+        }
+
+        constexpr Quat conjugate() const { return Quat(-x, -y, -z, w); }
+        constexpr T dot(const Quat& q) const { return x * q.x + y * q.y + z * q.z + w * q.w; }
+
+        Quat normalized() const {
+            using std::sqrt;
+            const T len = static_cast<T>(sqrt(dot(*this)));
+            if (len == T(0)) return Quat();
+            return Quat(x / len, y / len, z / len, w / len);
+        }
+
+        // v' = v + 2w (q x v) + 2 q x (q x v)
+        constexpr Vector3<T> rotate(const Vector3<T>& v) const {
+            const Vector3<T> q(x, y, z);
+            const Vector3<T> t = q.cross(v) * T(2);
+            return v + t * w + q.cross(t);
+        }
+
+        // Interpolation linéaire normalisée (chemin le plus court)
+        static Quat nlerp(const Quat& a, Quat b, T t) {
+            if (a.dot(b) < T(0)) b = Quat(-b.x, -b.y, -b.z, -b.w);
+            return Quat(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t,
+                        a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t).normalized();
+        }
+
+        constexpr bool operator==(const Quat& q) const { return x == q.x && y == q.y && z == q.z && w == q.w; }
+        constexpr bool operator!=(const Quat& q) const { return !(*this == q); }
+    };
+}
+
+#endif // QUAT_HPP
@@ -0,0 +1,290 @@
+#ifndef VEC_ARRAY_HPP
+#define VEC_ARRAY_HPP
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <Particule/Core/Types/Fixed.hpp>
+#include <Particule/Core/Types/FixedTables.hpp>
+#include <Particule/Core/Types/Rect.hpp>
+#include <Particule/Core/Types/Vector2.hpp>
+#include <Particule/Core/Types/Vector3.hpp>
+
+/*
+Tableaux de vecteurs fixed_t en structure de tableaux (SoA) et noyaux de calcul par lots.
+
+Les noyaux travaillent sur les valeurs raw : lanes 32 bits, produits élargis en 64 bits.
+Aucun intrinsèque : sur PC les boucles sont vectorisées par le compilateur (SSE4.1 / AVX2 / NEON),
+sur SH4 elles sont déroulées par 4 et restent en entiers.
+Les noyaux composante par composante acceptent out == a (calcul en place).
+*/
+
+namespace Particule::Core
+{
+    namespace Batch
+    {
+        template <typename R>
+        inline void Add(const R* a, const R* b, R* out, std::size_t count)
+        {
+#pragma GCC unroll 4
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = a[i] + b[i];
+        }
+
+        template <typename R>
+        inline void Sub(const R* a, const R* b, R* out, std::size_t count)
+        {
+#pragma GCC unroll 4
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = a[i] - b[i];
+        }
+
+        // out = a * s
+        template <int P, typename R>
+        inline void Scale(const R* a, R s, R* out, std::size_t count)
+        {
+            const int64_t s64 = s;
+#pragma GCC unroll 4
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = static_cast<R>((a[i] * s64) >> P);
+        }
+
+        // out = a + (b - a) * t
+        template <int P, typename R>
+        inline void Lerp(const R* a, const R* b, R t, R* out, std::size_t count)
+        {
+            const int64_t t64 = t;
+#pragma GCC unroll 4
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = static_cast<R>(a[i] + ((static_cast<int64_t>(b[i] - a[i]) * t64) >> P));
+        }
+
+        // out = clamp(a, lo, hi)
+        template <typename R>
+        inline void Clamp(const R* a, R lo, R hi, R* out, std::size_t count)
+        {
+#pragma GCC unroll 4
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const R v = a[i] < lo ? lo : a[i];
+                out[i] = v > hi ? hi : v;
+            }
+        }
+
+        template <int P, typename R>
+        inline void Dot2(const R* __restrict ax, const R* __restrict ay,
+                         const R* __restrict bx, const R* __restrict by, R* __restrict out, std::size_t count)
+        {
+#pragma GCC unroll 4
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = static_cast<R>((static_cast<int64_t>(ax[i]) * bx[i] + static_cast<int64_t>(ay[i]) * by[i]) >> P);
+        }
+
+        template <int P, typename R>
+        inline void Dot3(const R* __restrict ax, const R* __restrict ay, const R* __restrict az,
+                         const R* __restrict bx, const R* __restrict by, const R* __restrict bz,
+                         R* __restrict out, std::size_t count)
+        {
+#pragma GCC unroll 4
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] = static_cast<R>((static_cast<int64_t>(ax[i]) * bx[i] + static_cast<int64_t>(ay[i]) * by[i] +
+                                         static_cast<int64_t>(az[i]) * bz[i]) >> P);
+        }
+
+        // v * 1/sqrt(len2) pour chaque composante, len2 en Q(2P) ; vecteur nul inchangé
+        template <int P, typename R>
+        inline void ScaleByInvLength(uint64_t len2, R* const* comps, int n, std::size_t i)
+        {
+            if (len2 == 0) return;
+            int exponent = 0;
+            const int64_t inv = FixedLUT::InvSqrtQ16(len2, 2 * P, exponent); // Q16 * 2^exponent
+            const int shift = 16 - exponent;
+            for (int c = 0; c < n; ++c)
+            {
+                const int64_t p = static_cast<int64_t>(comps[c][i]) * inv;
+                comps[c][i] = static_cast<R>(shift >= 0 ? p >> shift : p << -shift);
+            }
+        }
+
+        template <int P, typename R>
+        inline void Normalize2(R* x, R* y, std::size_t count)
+        {
+            R* comps[2] = { x, y };
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const int64_t vx = x[i], vy = y[i];
+                ScaleByInvLength<P, R>(static_cast<uint64_t>(vx * vx) + static_cast<uint64_t>(vy * vy), comps, 2, i);
+            }
+        }
+
+        template <int P, typename R>
+        inline void Normalize3(R* x, R* y, R* z, std::size_t count)
+        {
+            R* comps[3] = { x, y, z };
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const int64_t vx = x[i], vy = y[i], vz = z[i];
+                ScaleByInvLength<P, R>(static_cast<uint64_t>(vx * vx) + static_cast<uint64_t>(vy * vy) +
+                                       static_cast<uint64_t>(vz * vz), comps, 3, i);
+            }
+        }
+    }
+
+    template <typename F> class Vec2Array;
+    template <typename F> class Vec3Array;
+
+    // Vecteurs 2D en SoA : x[] et y[] contigus (valeurs raw)
+    template <int P, typename R>
+    class Vec2Array<fixed_t<P, R>> {
+    public:
+        using value_type = fixed_t<P, R>;
+
+        std::vector<R> x;
+        std::vector<R> y;
+
+        Vec2Array() = default;
+        explicit Vec2Array(std::size_t count) { resize(count); }
+
+        inline std::size_t size() const noexcept { return x.size(); }
+        inline bool empty() const noexcept { return x.empty(); }
+        inline void resize(std::size_t count) { x.resize(count); y.resize(count); }
+        inline void reserve(std::size_t count) { x.reserve(count); y.reserve(count); }
+        inline void clear() noexcept { x.clear(); y.clear(); }
+
+        inline void push_back(const Vector2<value_type>& v) { x.push_back(v.x.raw()); y.push_back(v.y.raw()); }
+        inline void Set(std::size_t i, const Vector2<value_type>& v) noexcept { x[i] = v.x.raw(); y[i] = v.y.raw(); }
+        inline Vector2<value_type> Get(std::size_t i) const noexcept
+        {
+            return { value_type::from_raw(x[i]), value_type::from_raw(y[i]) };
+        }
+
+        // Les tableaux o doivent avoir au moins size() éléments
+        inline void Add(const Vec2Array& o) noexcept
+        {
+            Batch::Add(x.data(), o.x.data(), x.data(), size());
+            Batch::Add(y.data(), o.y.data(), y.data(), size());
+        }
+
+        inline void Sub(const Vec2Array& o) noexcept
+        {
+            Batch::Sub(x.data(), o.x.data(), x.data(), size());
+            Batch::Sub(y.data(), o.y.data(), y.data(), size());
+        }
+
+        inline void Scale(value_type s) noexcept
+        {
+            Batch::Scale<P>(x.data(), s.raw(), x.data(), size());
+            Batch::Scale<P>(y.data(), s.raw(), y.data(), size());
+        }
+
+        // this = this + (to - this) * t
+        inline void Lerp(const Vec2Array& to, value_type t) noexcept
+        {
+            Batch::Lerp<P>(x.data(), to.x.data(), t.raw(), x.data(), size());
+            Batch::Lerp<P>(y.data(), to.y.data(), t.raw(), y.data(), size());
+        }
+
+        // out[i] = this[i] . o[i] (raw)
+        inline void Dot(const Vec2Array& o, std::vector<R>& out) const
+        {
+            out.resize(size());
+            Batch::Dot2<P>(x.data(), y.data(), o.x.data(), o.y.data(), out.data(), size());
+        }
+
+        inline void Normalize() noexcept { Batch::Normalize2<P>(x.data(), y.data(), size()); }
+
+        inline void ClampToRect(value_type minX, value_type minY, value_type maxX, value_type maxY) noexcept
+        {
+            Batch::Clamp(x.data(), minX.raw(), maxX.raw(), x.data(), size());
+            Batch::Clamp(y.data(), minY.raw(), maxY.raw(), y.data(), size());
+        }
+
+        // Bornes incluses [x, x + w] x [y, y + h]
+        inline void ClampToRect(const Rect& r) noexcept
+        {
+            ClampToRect(value_type(r.x), value_type(r.y), value_type(r.x + r.w), value_type(r.y + r.h));
+        }
+    };
+
+    // Vecteurs 3D en SoA : x[], y[] et z[] contigus (valeurs raw)
+    template <int P, typename R>
+    class Vec3Array<fixed_t<P, R>> {
+    public:
+        using value_type = fixed_t<P, R>;
+
+        std::vector<R> x;
+        std::vector<R> y;
+        std::vector<R> z;
+
+        Vec3Array() = default;
+        explicit Vec3Array(std::size_t count) { resize(count); }
+
+        inline std::size_t size() const noexcept { return x.size(); }
+        inline bool empty() const noexcept { return x.empty(); }
+        inline void resize(std::size_t count) { x.resize(count); y.resize(count); z.resize(count); }
+        inline void reserve(std::size_t count) { x.reserve(count); y.reserve(count); z.reserve(count); }
+        inline void clear() noexcept { x.clear(); y.clear(); z.clear(); }
+
+        inline void push_back(const Vector3<value_type>& v)
+        {
+            x.push_back(v.x.raw()); y.push_back(v.y.raw()); z.push_back(v.z.raw());
+        }
+        inline void Set(std::size_t i, const Vector3<value_type>& v) noexcept
+        {
+            x[i] = v.x.raw(); y[i] = v.y.raw(); z[i] = v.z.raw();
+        }
+        inline Vector3<value_type> Get(std::size_t i) const noexcept
+        {
+            return { value_type::from_raw(x[i]), value_type::from_raw(y[i]), value_type::from_raw(z[i]) };
+        }
+
+        inline void Add(const Vec3Array& o) noexcept
+        {
+            Batch::Add(x.data(), o.x.data(), x.data(), size());
+            Batch::Add(y.data(), o.y.data(), y.data(), size());
+            Batch::Add(z.data(), o.z.data(), z.data(), size());
+        }
+
+        inline void Sub(const Vec3Array& o) noexcept
+        {
+            Batch::Sub(x.data(), o.x.data(), x.data(), size());
+            Batch::Sub(y.data(), o.y.data(), y.data(), size());
+            Batch::Sub(z.data(), o.z.data(), z.data(), size());
+        }
+
+        inline void Scale(value_type s) noexcept
+        {
+            Batch::Scale<P>(x.data(), s.raw(), x.data(), size());
+            Batch::Scale<P>(y.data(), s.raw(), y.data(), size());
+            Batch::Scale<P>(z.data(), s.raw(), z.data(), size());
+        }
+
+        inline void Lerp(const Vec3Array& to, value_type t) noexcept
+        {
+            Batch::Lerp<P>(x.data(), to.x.data(), t.raw(), x.data(), size());
+            Batch::Lerp<P>(y.data(), to.y.data(), t.raw(), y.data(), size());
+            Batch::Lerp<P>(z.data(), to.z.data(), t.raw(), z.data(), size());
+        }
+
+        inline void Dot(const Vec3Array& o, std::vector<R>& out) const
+        {
+            out.resize(size());
+            Batch::Dot3<P>(x.data(), y.data(), z.data(), o.x.data(), o.y.data(), o.z.data(), out.data(), size());
+        }
+
+        inline void Normalize() noexcept { Batch::Normalize3<P>(x.data(), y.data(), z.data(), size()); }
+
+        // Limite x et y au rectangle, z inchangé
+        inline void ClampToRect(value_type minX, value_type minY, value_type maxX, value_type maxY) noexcept
+        {
+            Batch::Clamp(x.data(), minX.raw(), maxX.raw(), x.data(), size());
+            Batch::Clamp(y.data(), minY.raw(), maxY.raw(), y.data(), size());
+        }
+
+        inline void ClampToRect(const Rect& r) noexcept
+        {
+            ClampToRect(value_type(r.x), value_type(r.y), value_type(r.x + r.w), value_type(r.y + r.h));
+        }
+    };
+}
+
+#endif // VEC_ARRAY_HPP
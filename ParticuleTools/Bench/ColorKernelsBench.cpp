@@ -0,0 +1,100 @@
+#include <Particule/Core/Graphics/ColorKernels.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+/*
+Mesure (make bench-color) : noyaux de ColorKernels sur une ligne d'écran Casio (396 pixels), comparés
+à l'ancien Color::MultiplyColorRaw appelé par pixel (divisions par 31 / 63 en RGB565, Mul8bit en RGBA8888)
+et aux versions pixel des mélanges. Chaque mesure garde le meilleur de RUNS passes.
+Le chemin dépend des options : -U__SSE2__ pour le SWAR 32 bits, défaut SSE2 sur x86-64, -mavx2.
+*/
+
+using namespace Particule::Core::ColorKernels;
+
+namespace {
+
+    constexpr int N = 396;
+    constexpr int REPS = 100000;
+    constexpr int RUNS = 5;
+
+    // Color::MultiplyColorRaw d'origine
+    inline uint16_t Mul565Old(uint16_t a, uint16_t b)
+    {
+        const unsigned ar = (a >> 11) & 0x1F, ag = (a >> 5) & 0x3F, ab = a & 0x1F;
+        const unsigned br = (b >> 11) & 0x1F, bg = (b >> 5) & 0x3F, bb = b & 0x1F;
+        return static_cast<uint16_t>((((ar * br + 15) / 31) << 11) | (((ag * bg + 31) / 63) << 5) | ((ab * bb + 15) / 31));
+    }
+
+    inline uint32_t Mul8bit(uint32_t a, uint32_t b) { return ((a * b + 128) * 257) >> 16; }
+
+    inline uint32_t Mul8888Old(uint32_t c1, uint32_t c2)
+    {
+        return (Mul8bit((c1 >> 24) & 0xFF, (c2 >> 24) & 0xFF) << 24) | (Mul8bit((c1 >> 16) & 0xFF, (c2 >> 16) & 0xFF) << 16)
+             | (Mul8bit((c1 >> 8) & 0xFF, (c2 >> 8) & 0xFF) << 8) | Mul8bit(c1 & 0xFF, c2 & 0xFF);
+    }
+
+    // Nanosecondes par appel de f, meilleure passe
+    template <typename F>
+    double Measure(F&& f)
+    {
+        double best = 1e30;
+        for (int run = 0; run < RUNS; run++)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < REPS; r++)
+            {
+                f();
+                asm volatile("" ::: "memory");
+            }
+            const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / REPS;
+            best = std::min(best, ns);
+        }
+        return best;
+    }
+
+    void Report(const char* name, const char* reference, double ref, double span)
+    {
+        printf("%-14s %-6s %7.0f ns  span %7.0f ns  x%.1f\n", name, reference, ref, span, ref / span);
+    }
+
+}
+
+int main()
+{
+#if defined(PARTICULE_COLOR_AVX2)
+    const char* path = "AVX2";
+#elif defined(PARTICULE_COLOR_SSE2)
+    const char* path = "SSE2";
+#elif defined(PARTICULE_COLOR_NEON)
+    const char* path = "NEON";
+#else
+    const char* path = "SWAR";
+#endif
+    std::vector<uint16_t> s16(N), d16(N);
+    std::vector<uint32_t> s32(N), d32(N);
+    uint32_t x = 1;
+    for (int i = 0; i < N; i++)
+    {
+        x = x * 1664525 + 1013904223;
+        s16[i] = static_cast<uint16_t>(x >> 16);
+        s32[i] = x;
+    }
+
+    printf("ColorKernels : %s, ligne de %d pixels, meilleur de %d passes\n", path, N, RUNS);
+    Report("Tint565", "ancien",
+        Measure([&] { for (int i = 0; i < N; i++) d16[i] = Mul565Old(s16[i], 0xB5A6); }),
+        Measure([&] { Tint565(d16.data(), s16.data(), N, 0xB5A6); }));
+    Report("TintRGBA8888", "ancien",
+        Measure([&] { for (int i = 0; i < N; i++) d32[i] = Mul8888Old(s32[i], 0xB0C0D0E0u); }),
+        Measure([&] { TintRGBA8888(d32.data(), s32.data(), N, 0xB0C0D0E0u); }));
+    Report("Blend565", "pixel",
+        Measure([&] { for (int i = 0; i < N; i++) d16[i] = Blend565Pixel(d16[i], s16[i], 13); }),
+        Measure([&] { Blend565(d16.data(), s16.data(), N, 100); }));
+    Report("BlendRGBA8888", "pixel",
+        Measure([&] { for (int i = 0; i < N; i++) d32[i] = BlendRGBA8888Pixel(d32[i], s32[i]); }),
+        Measure([&] { BlendRGBA8888(d32.data(), s32.data(), N); }));
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <Particule/Engine/ParticuleEngine.hpp>
+#include <cstdio>
+#include <vector>
+
+/*
+Vérification sous ThreadSanitizer (make tsan) : parents, enfants et petits-enfants ont tous un
+ParallelUpdate qui lit leur position monde et l'écrit (monde et local). Aucune course ne doit être
+signalée, et après chaque frame monde = monde du parent + local.
+*/
+
+using namespace Particule::Core;
+using namespace Particule::Engine;
+using V = Vector3<fixed12_32>;
+
+namespace {
+
+    constexpr int CHAINS = 200;
+    constexpr int FRAMES = 5;
+
+    struct Mover : Component
+    {
+        using Component::Component;
+        int seen = 0;
+
+        void ParallelUpdate() override
+        {
+            seen += static_cast<int>(V(gameObject.transform.position).x); // valeur du début de la phase
+            gameObject.transform.position.x += fixed12_32(1);              // relatif au cache du parent
+            gameObject.transform.Translate(V(fixed12_32(0), fixed12_32(1), fixed12_32(0)));
+        }
+    };
+
+    std::vector<GameObject*> chains[3]; // racines, enfants, petits-enfants
+
+    void Load(Scene& scene)
+    {
+        // Niveau par niveau : un parent et ses enfants tombent dans des jobs différents
+        for (int level = 0; level < 3; level++)
+            for (int i = 0; i < CHAINS; i++)
+            {
+                GameObject* go = scene.EmplaceGameObject<GameObject>("chain");
+                go->AddComponent<Mover>();
+                if (level) go->transform.SetParent(&chains[level - 1][i]->transform, false);
+                chains[level].push_back(go);
+            }
+    }
+
+    bool Consistent(const GameObject* child, const GameObject* parent)
+    {
+        const V w = child->transform.position, l = child->transform.localPosition, p = parent->transform.position;
+        return w.x == p.x + l.x && w.y == p.y + l.y;
+    }
+
+}
+
+int main()
+{
+    JobSystem::Init(4);
+    SceneManager manager;
+    manager.parallelGrain = 4;
+    manager.AddScene("check", Load);
+    manager.LoadScene(0);
+
+    int failures = 0;
+    for (int frame = 0; frame < FRAMES; frame++)
+    {
+        manager.MainLoop();
+        for (int i = 0; i < CHAINS; i++)
+            for (int level = 1; level < 3; level++)
+                if (!Consistent(chains[level][i], chains[level - 1][i])) failures++;
+    }
+    for (auto& level : chains)
+        for (GameObject* go : level)
+            if (static_cast<int>(V(go->transform.localPosition).y) != FRAMES) failures++;
+
+    printf("ParallelTransformCheck: %d chaînes x 3, %d frames, %d erreurs\n", CHAINS, FRAMES, failures);
+    fflush(stdout);
+    _Exit(failures ? 1 : 0);
+}
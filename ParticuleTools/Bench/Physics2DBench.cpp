@@ -0,0 +1,97 @@
+#include <Particule/Engine/ParticuleEngine.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/*
+Mesure (make bench-physics) : N corps (moitié boîtes, moitié cercles, masses et vitesses aléatoires)
+tombent dans une boîte de 1600 x 1200 unités. Temps de SceneManager::MainLoop complet (pas physique compris)
+sur TIMED frames, puis corps encore éveillés après SETTLE frames, et empreinte des positions finales :
+mêmes entrées, même empreinte, quelles que soient les options de compilation.
+*/
+
+using namespace Particule::Core;
+using namespace Particule::Engine;
+using X = fixed16_32;
+using V = Vector2<X>;
+using F = fixed12_32;
+
+namespace {
+
+    constexpr int WIDTH = 1600, HEIGHT = 1200;
+    constexpr int TIMED = 600;
+    constexpr int SETTLE = 2000;
+
+    int count = 0;
+    std::vector<Rigidbody2D*> bodies;
+
+    void Wall(Scene& scene, int x, int y, int w, int h)
+    {
+        GameObject* go = scene.EmplaceGameObject<GameObject>("wall");
+        go->transform.position = Vector3<F>(F(x), F(y), F(0));
+        go->AddComponent<BoxCollider2D>(V(X(w), X(h)));
+    }
+
+    void Load(Scene& scene)
+    {
+        std::mt19937 rng(1234);
+        bodies.clear();
+        scene.physics().gravity = V(X(0), X(300));
+        Wall(scene, WIDTH / 2, HEIGHT + 10, WIDTH + 40, 20);
+        Wall(scene, -10, 0, 20, 2 * HEIGHT + 40);
+        Wall(scene, WIDTH + 10, 0, 20, 2 * HEIGHT + 40);
+        for (int i = 0; i < count; i++)
+        {
+            GameObject* go = scene.EmplaceGameObject<GameObject>("body");
+            go->transform.position = Vector3<F>(F(int(rng() % WIDTH)), F(int(rng() % HEIGHT) - HEIGHT), F(0));
+            Rigidbody2D* body = go->AddComponent<Rigidbody2D>(X(1 + int(rng() % 3)));
+            body->SetVelocity(V(X(int(rng() % 200) - 100), X(int(rng() % 200) - 100)));
+            if (i % 2)
+                go->AddComponent<CircleCollider2D>(X(3 + int(rng() % 4)));
+            else
+                go->AddComponent<BoxCollider2D>(V(X(6 + int(rng() % 6)), X(6 + int(rng() % 6))));
+            bodies.push_back(body);
+        }
+    }
+
+}
+
+int main()
+{
+    printf("Physics2D : MainLoop complet, %d frames mesurées, corps éveillés après %d frames\n", TIMED, SETTLE);
+    for (int n : { 1000, 2000, 4000 })
+    {
+        count = n;
+        SceneManager manager;
+        manager.AddScene("bench", Load);
+        manager.LoadScene(0);
+        manager.MainLoop();
+
+        double total = 0, worst = 0;
+        for (int frame = 0; frame < TIMED; frame++)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            manager.MainLoop();
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            total += ms;
+            worst = std::max(worst, ms);
+        }
+        for (int frame = TIMED; frame < SETTLE; frame++)
+            manager.MainLoop();
+
+        uint64_t hash = 1469598103934665603ull;
+        int awake = 0;
+        for (const Rigidbody2D* body : bodies)
+        {
+            hash = (hash ^ uint32_t(body->position().x.raw())) * 1099511628211ull;
+            hash = (hash ^ uint32_t(body->position().y.raw())) * 1099511628211ull;
+            awake += body->IsAwake();
+        }
+        printf("%5d corps  moyenne %6.3f ms  pire %6.3f ms  éveillés %4d  empreinte %016llx\n",
+               n, total / TIMED, worst, awake, static_cast<unsigned long long>(hash));
+        fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <Particule/P3D/Raster/Rasterizer.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+/*
+Mesure (make bench-raster) : Rasterizer::DrawIndexed dans un framebuffer 396 x 224, faces arrière écartées,
+z-buffer effacé à chaque frame. Grille de n x n quads couvrant toujours la même zone (~53 000 pixels),
+légèrement inclinée en profondeur : seule la taille des triangles change. Meilleur de RUNS passes de FRAMES.
+*/
+
+using namespace Particule::Core;
+using namespace Particule::P3D;
+
+namespace {
+
+    constexpr int WIDTH = 396, HEIGHT = 224;
+    constexpr int FRAMES = 200;
+    constexpr int RUNS = 5;
+
+}
+
+int main()
+{
+    Framebuffer fb(WIDTH, HEIGHT);
+    Rasterizer raster(fb);
+    raster.SetProjection(200, fixed12_32(1) / 10, fixed12_32(100));
+    raster.cullMode = CullMode::Back;
+
+    printf("Rasterizer : %d x %d, meilleur de %d passes de %d frames\n", WIDTH, HEIGHT, RUNS, FRAMES);
+    for (int n : { 8, 16, 32, 64 })
+    {
+        VertexBuffer vb;
+        vb.resize((n + 1) * (n + 1));
+        std::vector<uint32_t> colors((n + 1) * (n + 1));
+        for (int j = 0; j <= n; j++)
+            for (int i = 0; i <= n; i++)
+            {
+                vb.Set(j * (n + 1) + i, { fixed12_32(-3) + fixed12_32(6) * i / n, fixed12_32(-2) + fixed12_32(4) * j / n,
+                                          fixed12_32(4) + fixed12_32(i) / (n * 2) });
+                colors[j * (n + 1) + i] = ((i * 255 / n) << 16) | ((j * 255 / n) << 8) | 0x80;
+            }
+        std::vector<uint16_t> indices;
+        std::vector<ColorRaw> faces;
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < n; i++)
+            {
+                const uint16_t a = static_cast<uint16_t>(j * (n + 1) + i);
+                indices.insert(indices.end(), { a, uint16_t(a + n + 1), uint16_t(a + 1), uint16_t(a + 1), uint16_t(a + n + 1), uint16_t(a + n + 2) });
+                faces.push_back(0xFF8040FFu);
+                faces.push_back(0x40FF80FFu);
+            }
+
+        for (ShadeMode mode : { ShadeMode::Flat, ShadeMode::Gouraud })
+        {
+            auto frame = [&] {
+                fb.ClearDepth();
+                raster.DrawIndexed(vb, colors.data(), indices.data(), indices.size(), mode, faces.data());
+            };
+            raster.stats = {};
+            frame();
+            const unsigned drawn = raster.stats.drawn;
+            int pixels = 0;
+            for (int k = 0; k < WIDTH * HEIGHT; k++)
+                pixels += fb.DepthData()[k] != 0;
+
+            double best = 1e30;
+            for (int run = 0; run < RUNS; run++)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                for (int f = 0; f < FRAMES; f++)
+                    frame();
+                best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / FRAMES);
+            }
+            printf("%-7s %5u triangles  %6d px  %.3f ms/frame  %5.2f Mtri/s  %4.0f Mpx/s\n",
+                   mode == ShadeMode::Flat ? "plat" : "gouraud", drawn, pixels, best, drawn / best / 1000, pixels / best / 1000);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <Particule/Core/Types/VecArray.hpp>
+#include <Particule/Core/Types/Vector3.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+/*
+Mesure (make bench-vecarray) : opérations de Vec3Array<fixed12_32> (SoA) contre la même boucle sur un
+std::vector<Vector3<fixed12_32>> avec les opérateurs de Vector3. Normalize repart des mêmes vecteurs
+aléatoires à chaque appel (copie comprise des deux côtés).
+Meilleur de RUNS passes ; gain = temps de la boucle Vector3 / temps de Vec3Array.
+*/
+
+using namespace Particule::Core;
+using F = fixed12_32;
+using V = Vector3<F>;
+
+namespace {
+
+    constexpr int RUNS = 5;
+
+    // Microsecondes par appel de f, meilleure passe
+    template <typename Fn>
+    double Measure(int reps, Fn&& f)
+    {
+        double best = 1e30;
+        for (int run = 0; run < RUNS; run++)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < reps; r++)
+            {
+                f();
+                asm volatile("" ::: "memory");
+            }
+            best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / reps);
+        }
+        return best;
+    }
+
+    void Report(const char* name, double aos, double soa)
+    {
+        printf("  %-10s Vector3 %8.2f us  Vec3Array %8.2f us  x%.1f\n", name, aos, soa, aos / soa);
+    }
+
+}
+
+int main()
+{
+    printf("Vec3Array : meilleur de %d passes\n", RUNS);
+    for (int n : { 1000, 10000 })
+    {
+        std::vector<V> a(n), b(n);
+        std::vector<F> d(n);
+        Vec3Array<F> sa(n), sb(n);
+        std::vector<int32_t> sd;
+        uint32_t seed = 7;
+        auto random = [&] {
+            seed = seed * 1664525 + 1013904223;
+            return F::from_raw(int32_t(seed >> 12) - (1 << 19));
+        };
+        for (int i = 0; i < n; i++)
+        {
+            a[i] = V(random(), random(), random());
+            b[i] = V(random(), random(), random());
+            sa.Set(i, a[i]);
+            sb.Set(i, b[i]);
+        }
+        const std::vector<V> a0 = a;
+        const Vec3Array<F> sa0 = sa;
+        const F t = F(1) / 4, k = F(1);
+        const int reps = 2000000 / n;
+
+        printf("n = %d\n", n);
+        Report("Add", Measure(reps, [&] { for (int i = 0; i < n; i++) a[i] = a[i] + b[i]; }),
+                      Measure(reps, [&] { sa.Add(sb); }));
+        Report("Scale", Measure(reps, [&] { for (int i = 0; i < n; i++) a[i] = a[i] * k; }),
+                        Measure(reps, [&] { sa.Scale(k); }));
+        Report("Lerp", Measure(reps, [&] { for (int i = 0; i < n; i++) a[i] = a[i] + (b[i] - a[i]) * t; }),
+                       Measure(reps, [&] { sa.Lerp(sb, t); }));
+        Report("Dot", Measure(reps, [&] { for (int i = 0; i < n; i++) d[i] = a[i].dot(b[i]); }),
+                      Measure(reps, [&] { sa.Dot(sb, sd); }));
+        Report("Normalize", Measure(reps, [&] { a = a0; for (int i = 0; i < n; i++) a[i] = a[i].normalized(); }),
+                            Measure(reps, [&] { sa = sa0; sa.Normalize(); }));
+    }
+    return 0;
+}